@@ -0,0 +1,110 @@
+﻿#include "chat_bench.h"
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include "protocol.pb.h"
+#pragma comment(lib, "libboost_exception-vc141-mt-gd-x32-1_72.lib")
+using namespace std;
+
+//进程内所有operator new的调用次数
+static atomic<size_t> allocation_count{ 0 };
+
+void *operator new(size_t size) {
+	allocation_count.fetch_add(1, memory_order_relaxed);
+	if (void *p = malloc(size ? size : 1))
+		return p;
+	throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+	free(p);
+}
+
+/**
+ * @brief 进程启动以来operator new的调用次数,前后两次相减即一段代码的堆分配次数
+ * @param
+ * @return size_t
+ */
+size_t bench_allocations() {
+	return allocation_count.load(memory_order_relaxed);
+}
+
+/**
+ * @brief 将"--key=value"拆分为key和value
+ * @param arg 参数
+ * @param key 输出的key
+ * @param value 输出的value
+ * @return bool 格式是否正确
+ */
+bool split_bench_option(const string &arg, string &key, string &value) {
+	auto pos = arg.find('=');
+	if (arg.compare(0, 2, "--") != 0 || pos == string::npos)
+		return false;
+	key = arg.substr(2, pos - 2);
+	value = arg.substr(pos + 1);
+	return true;
+}
+
+/**
+ * @brief 取样本的百分位数,会对样本排序
+ * @param samples 样本
+ * @param p 百分位,0到1
+ * @return double 样本为空时返回0
+ */
+double percentile(vector<double> &samples, double p) {
+	if (samples.empty())
+		return 0;
+	sort(samples.begin(), samples.end());
+	size_t index = min(samples.size() - 1, size_t(p * samples.size()));
+	return samples[index];
+}
+
+/**
+ * @brief 一个基准,按名字选择
+ */
+struct bench_suite {
+	const char *name;
+	int (*run)(int argc, const char *const *argv);
+	const char *description;
+};
+
+static const bench_suite suites[] = {
+	{ "transport", bench_transport, "round trips through a running chat_server over tcp/unix/shm" },
+	{ "registry", bench_registry, "room member container: std::set vs slot map" },
+	{ "decode", bench_decode, "chat decode and room info encode: string copies vs arena vs splice" },
+	{ "serialize", bench_serialize, "client encoders and server decoders for raw/text/json/protobuf/flat" },
+};
+
+int main(int argc, const char *const *argv) {
+	const bench_suite *suite = nullptr;
+	for (const auto &s : suites) {
+		if (argc >= 2 && strcmp(argv[1], s.name) == 0)
+			suite = &s;
+	}
+	if (!suite) {
+		cerr << "usage: " << argv[0] << " <suite> [--key=value ...]\n";
+		for (const auto &s : suites)
+			cerr << "  " << s.name << "\t" << s.description << "\n";
+		return 1;
+	}
+
+	int ret = 1;
+	try {
+		GOOGLE_PROTOBUF_VERIFY_VERSION;
+		ret = suite->run(argc, argv);
+	}
+	catch (exception &e) {
+		cerr << "Exception " << e.what() << endl;
+	}
+
+	google::protobuf::ShutdownProtobufLibrary();
+	return ret;
+}
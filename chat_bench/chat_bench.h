@@ -0,0 +1,62 @@
+﻿#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+
+using bench_clock = std::chrono::steady_clock;
+
+/**
+ * @brief 将"--key=value"拆分为key和value
+ * @param arg 参数
+ * @param key 输出的key
+ * @param value 输出的value
+ * @return bool 格式是否正确
+ */
+bool split_bench_option(const std::string &arg, std::string &key, std::string &value);
+
+/**
+ * @brief 取样本的百分位数,会对样本排序
+ * @param samples 样本
+ * @param p 百分位,0到1
+ * @return double 样本为空时返回0
+ */
+double percentile(std::vector<double> &samples, double p);
+
+/**
+ * @brief 进程启动以来operator new的调用次数,前后两次相减即一段代码的堆分配次数
+ * @param
+ * @return size_t
+ */
+size_t bench_allocations();
+
+/**
+ * @brief 传输基准: 经过正在运行的chat_server往返,对比loopback tcp、Unix域socket和共享内存环
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_transport(int argc, const char *const *argv);
+
+/**
+ * @brief 房间成员容器基准: std::set<shared_ptr>与ptr_slot_map的加入、广播遍历、离开
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_registry(int argc, const char *const *argv);
+
+/**
+ * @brief 解码基准: 聊天消息解码和聊天室信息编码,对比复制成std::string的旧做法、零拷贝解码加Arena和直接拼接
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_decode(int argc, const char *const *argv);
+
+/**
+ * @brief 编码基准: parse_message到parse_message5五种客户端编码,以及服务端对应的解码
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_serialize(int argc, const char *const *argv);
@@ -0,0 +1,203 @@
+﻿#include "chat_bench.h"
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "chat_message.h"
+#include "protobuf_codec.h"
+#include "protocol.pb.h"
+using namespace std;
+
+/**
+ * @brief 解码基准的参数
+ */
+struct decode_options {
+	//聊天内容的字节数
+	vector<size_t> sizes = { 16, 64, 1024, 16 * 1024 };
+	//每个规模处理的消息数
+	int count = 200000;
+	//发送者名字
+	string name = "bench.decode";
+};
+
+/**
+ * @brief 旧的处理方式: 消息体先复制成std::string再ParseFromString,
+ *        聊天内容复制进成员字符串,再在栈上构造PRoomInformation序列化成std::string,最后复制进消息帧
+ */
+struct copy_path {
+	static const char *name() {
+		return "copy";
+	}
+
+	shared_ptr<chat_message> handle(const char *body, size_t body_length) {
+		PChat chat;
+		string str(body, body + body_length);
+		if (!chat.ParseFromString(str))
+			return nullptr;
+		information = chat.information();
+
+		PRoomInformation info;
+		info.set_name(bind_name);
+		info.set_information(information);
+		info.set_room_id(room_id);
+		info.set_seq(~0ull);
+		auto msg = make_shared<chat_message>();
+		msg->set_message(MT_ROOM_INFO, info.SerializeAsString());
+		return msg;
+	}
+
+	string bind_name;
+	string information;
+	uint64_t room_id = 1;
+};
+
+/**
+ * @brief 现在的处理方式: 零拷贝输入流直接解码消息体,protobuf对象建在线程的Arena上,
+ *        聊天内容从PChat移进PRoomInformation,PRoomInformation直接序列化进消息帧
+ */
+struct arena_path {
+	static const char *name() {
+		return "arena";
+	}
+
+	shared_ptr<chat_message> handle(const char *body, size_t body_length) {
+		message_arena::scope arena_scope;
+		auto chat = parse_on_arena<PChat>(body, body_length);
+		if (!chat)
+			return nullptr;
+
+		auto info = message_arena::create<PRoomInformation>();
+		info->set_name(bind_name);
+		info->set_information(std::move(*chat->mutable_information()));
+		info->set_room_id(room_id);
+		info->set_seq(~0ull);
+		auto msg = make_shared<chat_message>();
+		if (!serialize_protobuf(*info, MT_ROOM_INFO, *msg))
+			return nullptr;
+		return msg;
+	}
+
+	string bind_name;
+	uint64_t room_id = 1;
+};
+
+/**
+ * @brief 拼接的处理方式: 扫描消息体定位聊天内容,不构造任何protobuf对象,
+ *        把绑定名字时编码好的名字字段和聊天内容直接拼进消息帧
+ */
+struct splice_path {
+	static const char *name() {
+		return "splice";
+	}
+
+	shared_ptr<chat_message> handle(const char *body, size_t body_length) {
+		if (name_field.empty())
+			name_field = encode_string_field(PRoomInformation::kNameFieldNumber, bind_name);
+		const char *information;
+		size_t information_size;
+		uint64_t unused_room_id = 0;
+		if (!scan_chat_fields(body, body_length, PChat::kInformationFieldNumber, 0,
+							  information, information_size, unused_room_id))
+			return nullptr;
+		auto msg = make_shared<chat_message>();
+		if (!encode_room_info(name_field, room_id, information, information_size, ~0ull, *msg))
+			return nullptr;
+		return msg;
+	}
+
+	string bind_name;
+	string name_field;
+	uint64_t room_id = 1;
+};
+
+/**
+ * @brief 对一种处理方式跑一个规模,输出每条消息的耗时和堆分配次数
+ * @param body 编码好的PChat
+ * @param options 参数
+ * @return
+ */
+template <typename Path>
+static void bench_path(const string &body, size_t size, const decode_options &options) {
+	Path path;
+	path.bind_name = options.name;
+	size_t bytes = 0;
+
+	//预热,让buffer_pool和Arena的初始块就位
+	for (int i = 0; i < 100; ++i)
+		path.handle(body.data(), body.size());
+
+	size_t allocations = bench_allocations();
+	auto start = bench_clock::now();
+	for (int i = 0; i < options.count; ++i) {
+		auto msg = path.handle(body.data(), body.size());
+		if (msg)
+			bytes += msg->length();
+	}
+	double elapsed_ns = chrono::duration<double, nano>(bench_clock::now() - start).count();
+	allocations = bench_allocations() - allocations;
+
+	cout << "decode=" << Path::name()
+		 << " size=" << size
+		 << " msgs=" << options.count
+		 << " ns_per_msg=" << elapsed_ns / options.count
+		 << " allocs_per_msg=" << double(allocations) / options.count
+		 << " out_bytes=" << bytes / options.count << endl;
+}
+
+/**
+ * @brief 解析解码基准的参数
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[2]开始为选项
+ * @param options 输出
+ * @return bool 是否解析成功
+ */
+static bool parse_decode_options(int argc, const char *const *argv, decode_options &options) {
+	for (int i = 2; i < argc; ++i) {
+		string key, value;
+		if (!split_bench_option(argv[i], key, value))
+			return false;
+		if (key == "sizes") {
+			options.sizes.clear();
+			stringstream ss(value);
+			string item;
+			while (getline(ss, item, ','))
+				options.sizes.push_back(strtoul(item.c_str(), nullptr, 10));
+		}
+		else if (key == "count")
+			options.count = atoi(value.c_str());
+		else if (key == "name")
+			options.name = value;
+		else
+			return false;
+	}
+	return !options.sizes.empty() && options.count > 0;
+}
+
+/**
+ * @brief 解码基准: 聊天消息解码和聊天室信息编码,对比复制成std::string的旧做法、零拷贝解码加Arena和直接拼接
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_decode(int argc, const char *const *argv) {
+	decode_options options;
+	if (!parse_decode_options(argc, argv, options)) {
+		cerr << "usage: " << argv[0] << " decode [options]\n"
+			 << "  --sizes=A,B,...   chat payload bytes (default 16,64,1024,16384)\n"
+			 << "  --count=N         messages per size (default 200000)\n"
+			 << "  --name=S          bound sender name (default bench.decode)\n";
+		return 1;
+	}
+
+	for (auto size : options.sizes) {
+		PChat chat;
+		chat.set_information(string(size, 'x'));
+		string body = chat.SerializeAsString();
+		bench_path<copy_path>(body, size, options);
+		bench_path<arena_path>(body, size, options);
+		bench_path<splice_path>(body, size, options);
+	}
+	return 0;
+}
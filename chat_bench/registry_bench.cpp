@@ -0,0 +1,212 @@
+﻿#include "chat_bench.h"
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "chat_room.h"
+#include "slot_map.h"
+using namespace std;
+
+/**
+ * @brief 只计数的房间成员,deliver的开销与真实session的入队相比可以忽略
+ */
+class counting_participant : public chat_participant {
+public:
+	void deliver(const chat_message_ptr &msg) override {
+		++delivered_;
+		bytes_ += msg->length();
+	}
+
+	size_t delivered_ = 0;
+	size_t bytes_ = 0;
+};
+
+/**
+ * @brief 成员容器基准的参数
+ */
+struct registry_options {
+	vector<size_t> sizes = { 1000, 10000, 100000 };
+	//每个规模广播的次数
+	int broadcasts = 20;
+	//每个规模离开再加入的次数
+	int churn = 100000;
+	unsigned seed = 1;
+};
+
+/**
+ * @brief std::set<shared_ptr>,即原来chat_room的成员容器
+ */
+struct set_container {
+	static const char *name() {
+		return "std::set";
+	}
+
+	void insert(const chat_participant_ptr &cp) {
+		members.insert(cp);
+	}
+
+	void erase(const chat_participant_ptr &cp) {
+		members.erase(cp);
+	}
+
+	void broadcast(const chat_message_ptr &msg) {
+		for (auto &cp : members)
+			cp->deliver(msg);
+	}
+
+	set<chat_participant_ptr> members;
+};
+
+/**
+ * @brief ptr_slot_map,现在chat_room的成员容器
+ */
+struct slot_map_container {
+	static const char *name() {
+		return "slot_map";
+	}
+
+	void insert(const chat_participant_ptr &cp) {
+		members.insert(cp);
+	}
+
+	void erase(const chat_participant_ptr &cp) {
+		members.erase(cp.get());
+	}
+
+	void broadcast(const chat_message_ptr &msg) {
+		for (auto &member : members)
+			member.key->deliver(msg);
+	}
+
+	ptr_slot_map<chat_participant> members;
+};
+
+template <typename F>
+static double elapsed_ns(F &&f) {
+	auto start = bench_clock::now();
+	f();
+	return chrono::duration<double, nano>(bench_clock::now() - start).count();
+}
+
+/**
+ * @brief 对一种容器跑一个规模:加入全部成员、广播、随机离开再加入、全部离开
+ * @param participants 成员,按随机顺序加入
+ * @param options 参数
+ * @return
+ */
+template <typename Container>
+static void bench_container(const vector<chat_participant_ptr> &participants, const registry_options &options) {
+	mt19937 rng(options.seed);
+	auto msg = make_shared<chat_message>();
+	msg->set_message(MT_ROOM_INFO, string(64, 'x'));
+	chat_message_ptr shared_msg(msg);
+
+	Container container;
+	size_t n = participants.size();
+	double insert_ns = elapsed_ns([&] {
+		for (const auto &cp : participants)
+			container.insert(cp);
+	});
+
+	//预热一次,之后取平均
+	container.broadcast(shared_msg);
+	double broadcast_ns = elapsed_ns([&] {
+		for (int i = 0; i < options.broadcasts; ++i)
+			container.broadcast(shared_msg);
+	});
+
+	uniform_int_distribution<size_t> pick(0, n - 1);
+	vector<size_t> churn(options.churn);
+	for (auto &i : churn)
+		i = pick(rng);
+	double churn_ns = elapsed_ns([&] {
+		for (auto i : churn) {
+			container.erase(participants[i]);
+			container.insert(participants[i]);
+		}
+	});
+
+	vector<chat_participant_ptr> leave_order(participants);
+	shuffle(leave_order.begin(), leave_order.end(), rng);
+	double erase_ns = elapsed_ns([&] {
+		for (const auto &cp : leave_order)
+			container.erase(cp);
+	});
+
+	cout << "container=" << Container::name()
+		 << " members=" << n
+		 << " insert_ns=" << insert_ns / n
+		 << " broadcast_ns_per_member=" << broadcast_ns / (double(options.broadcasts) * n)
+		 << " broadcast_us=" << broadcast_ns / options.broadcasts / 1000
+		 << " leave_join_ns=" << (options.churn ? churn_ns / options.churn : 0)
+		 << " erase_ns=" << erase_ns / n << endl;
+}
+
+/**
+ * @brief 解析成员容器基准的参数
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[2]开始为选项
+ * @param options 输出
+ * @return bool 是否解析成功
+ */
+static bool parse_registry_options(int argc, const char *const *argv, registry_options &options) {
+	for (int i = 2; i < argc; ++i) {
+		string key, value;
+		if (!split_bench_option(argv[i], key, value))
+			return false;
+		if (key == "sizes") {
+			options.sizes.clear();
+			stringstream ss(value);
+			string item;
+			while (getline(ss, item, ','))
+				options.sizes.push_back(strtoul(item.c_str(), nullptr, 10));
+		}
+		else if (key == "broadcasts")
+			options.broadcasts = atoi(value.c_str());
+		else if (key == "churn")
+			options.churn = atoi(value.c_str());
+		else if (key == "seed")
+			options.seed = unsigned(strtoul(value.c_str(), nullptr, 10));
+		else
+			return false;
+	}
+	return !options.sizes.empty() && options.broadcasts > 0 && options.churn >= 0 &&
+		   find(options.sizes.begin(), options.sizes.end(), size_t(0)) == options.sizes.end();
+}
+
+/**
+ * @brief 房间成员容器基准: std::set<shared_ptr>与ptr_slot_map的加入、广播遍历、离开
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_registry(int argc, const char *const *argv) {
+	registry_options options;
+	if (!parse_registry_options(argc, argv, options)) {
+		cerr << "usage: " << argv[0] << " registry [options]\n"
+			 << "  --sizes=A,B,...   member counts (default 1000,10000,100000)\n"
+			 << "  --broadcasts=N    broadcasts per size (default 20)\n"
+			 << "  --churn=N         random leave+join pairs per size (default 100000)\n"
+			 << "  --seed=N          random seed (default 1)\n";
+		return 1;
+	}
+
+	mt19937 rng(options.seed);
+	for (auto n : options.sizes) {
+		//成员按随机顺序加入,与真实连接的分配顺序无关
+		vector<chat_participant_ptr> participants;
+		participants.reserve(n);
+		for (size_t i = 0; i < n; ++i)
+			participants.push_back(make_shared<counting_participant>());
+		shuffle(participants.begin(), participants.end(), rng);
+
+		bench_container<set_container>(participants, options);
+		bench_container<slot_map_container>(participants, options);
+	}
+	return 0;
+}
@@ -0,0 +1,403 @@
+﻿#include "chat_bench.h"
+#include <iostream>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "chat_handler.h"
+#include "chat_codec.h"
+#include "struct_header.h"
+#include "protocol.pb.h"
+using namespace std;
+
+/**
+ * @brief 编码基准的参数
+ */
+struct serialize_options {
+	//聊天内容的字节数,客户端的编码函数最多接受256字节
+	vector<size_t> sizes = { 8, 32, 128, 256 };
+	//字符集: ascii/cjk/emoji/escape
+	vector<string> charsets = { "ascii", "cjk", "emoji", "escape" };
+	//编码: raw/text/json/protobuf/flat
+	vector<int> codecs = { CODEC_RAW, CODEC_TEXT, CODEC_JSON, CODEC_PROTOBUF, CODEC_FLAT };
+	//每项测量的次数,吞吐和延迟各跑一遍
+	int count = 20000;
+	//输出格式: kv为每行key=value,json为每行一个json对象
+	string format = "kv";
+};
+
+/**
+ * @brief 一项测量的结果
+ */
+struct serialize_result {
+	string codec;
+	string op;
+	string charset;
+	size_t size = 0;
+	int ops = 0;
+	double ns_per_op = 0;
+	double p50_ns = 0;
+	double p99_ns = 0;
+	double max_ns = 0;
+	double allocs_per_op = 0;
+	//编码输出或解码输入的字节数
+	size_t wire_bytes = 0;
+	//解码结果与原文一致
+	bool ok = true;
+};
+
+/**
+ * @brief 生成恰好不超过size字节的聊天内容,多字节字符不会被截断
+ * @param charset 字符集
+ * @param size 字节数上限
+ * @return string
+ */
+static string make_payload(const string &charset, size_t size) {
+	//escape是json需要转义的引号、反斜杠和控制字符混在ascii中
+	const char *unit = "a";
+	if (charset == "cjk")
+		unit = "\xe8\x81\x8a";
+	else if (charset == "emoji")
+		unit = "\xf0\x9f\x98\x80";
+	else if (charset == "escape")
+		unit = "\"\\\t/x";
+	string payload;
+	size_t unit_size = strlen(unit);
+	while (payload.size() + unit_size <= size)
+		payload += unit;
+	//用ascii补齐剩余的字节
+	payload.append(size - payload.size(), 'a');
+	return payload;
+}
+
+/**
+ * @brief 只记录解码结果的handler,代替chat_handler接收raw_codec解码出的字段
+ */
+struct capture_handler {
+	void rebind_name(const string &name) {
+		information = name;
+	}
+
+	void post(uint64_t, const char *data, size_t size) {
+		information.assign(data, size);
+	}
+
+	void join(uint64_t, uint64_t) {
+	}
+
+	void leave(uint64_t) {
+	}
+
+	void direct(const string &, const string &) {
+	}
+
+	void handle_message(int, const char *, size_t) {
+	}
+
+	string information;
+};
+
+/**
+ * @brief 服务端对一种编码的聊天消息的解码,与chat_handler中的解码函数一一对应
+ * @param codec 编码
+ * @param body 消息体
+ * @param information 输出解码出的聊天内容
+ * @return bool 是否解码成功
+ */
+static bool server_decode(int codec, const string &body, string &information) {
+	switch (codec) {
+	case CODEC_RAW: {
+		capture_handler handler;
+		raw_codec::decode(handler, MT_CHAT_INFO, body.data(), body.size());
+		information.swap(handler.information);
+		return true;
+	}
+	case CODEC_FLAT: {
+		capture_handler handler;
+		flat_codec::decode(handler, MT_CHAT_INFO, body.data(), body.size());
+		information.swap(handler.information);
+		return true;
+	}
+	case CODEC_TEXT:
+		information = chat_handler::serialize_object<SChatInfo>(body.data(), body.size()).chat_information();
+		return true;
+	case CODEC_JSON:
+		information = chat_handler::to_ptree(body.data(), body.size()).get<string>("information");
+		return true;
+	default: {
+		PChat chat;
+		if (!chat_handler::fill_protobuf(&chat, body.data(), body.size()))
+			return false;
+		information.swap(*chat.mutable_information());
+		return true;
+	}
+	}
+}
+
+/**
+ * @brief 测量一个操作: 先整体计时得到吞吐和分配次数,再逐次计时得到延迟分布
+ * @param result 输出,填写ops及以后的测量值
+ * @param count 次数
+ * @param op 被测操作
+ * @return
+ */
+static void measure(serialize_result &result, int count, const function<void()> &op) {
+	for (int i = 0; i < 100; ++i)
+		op();
+
+	size_t allocations = bench_allocations();
+	auto start = bench_clock::now();
+	for (int i = 0; i < count; ++i)
+		op();
+	double elapsed_ns = chrono::duration<double, nano>(bench_clock::now() - start).count();
+	allocations = bench_allocations() - allocations;
+
+	vector<double> samples;
+	samples.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		auto op_start = bench_clock::now();
+		op();
+		samples.push_back(chrono::duration<double, nano>(bench_clock::now() - op_start).count());
+	}
+
+	result.ops = count;
+	result.ns_per_op = elapsed_ns / count;
+	result.allocs_per_op = double(allocations) / count;
+	result.p50_ns = percentile(samples, 0.5);
+	result.p99_ns = percentile(samples, 0.99);
+	result.max_ns = percentile(samples, 1.0);
+}
+
+/**
+ * @brief 输出一项结果
+ * @param result 结果
+ * @param format kv或json
+ * @return
+ */
+static void print_result(const serialize_result &result, const string &format) {
+	double ops_per_sec = result.ns_per_op > 0 ? 1e9 / result.ns_per_op : 0;
+	if (format == "json") {
+		cout << "{\"suite\":\"serialize\""
+			 << ",\"codec\":\"" << result.codec << "\""
+			 << ",\"op\":\"" << result.op << "\""
+			 << ",\"charset\":\"" << result.charset << "\""
+			 << ",\"size\":" << result.size
+			 << ",\"ops\":" << result.ops
+			 << ",\"ns_per_op\":" << result.ns_per_op
+			 << ",\"ops_per_sec\":" << ops_per_sec
+			 << ",\"p50_ns\":" << result.p50_ns
+			 << ",\"p99_ns\":" << result.p99_ns
+			 << ",\"max_ns\":" << result.max_ns
+			 << ",\"allocs_per_op\":" << result.allocs_per_op
+			 << ",\"wire_bytes\":" << result.wire_bytes
+			 << ",\"ok\":" << (result.ok ? "true" : "false") << "}" << endl;
+		return;
+	}
+	cout << "suite=serialize"
+		 << " codec=" << result.codec
+		 << " op=" << result.op
+		 << " charset=" << result.charset
+		 << " size=" << result.size
+		 << " ops=" << result.ops
+		 << " ns_per_op=" << result.ns_per_op
+		 << " ops_per_sec=" << ops_per_sec
+		 << " p50_ns=" << result.p50_ns
+		 << " p99_ns=" << result.p99_ns
+		 << " max_ns=" << result.max_ns
+		 << " allocs_per_op=" << result.allocs_per_op
+		 << " wire_bytes=" << result.wire_bytes
+		 << " ok=" << (result.ok ? 1 : 0) << endl;
+}
+
+/**
+ * @brief 测量客户端收到MT_ROOM_INFO后取出字段: protobuf要解析出PRoomInformation,flat直接在消息体上读取
+ * @param codec CODEC_PROTOBUF或CODEC_FLAT
+ * @param base 填好编码、字符集和大小的结果
+ * @param payload 聊天内容
+ * @param options 参数
+ * @return
+ */
+static void bench_receive(int codec, const serialize_result &base, const string &payload, const serialize_options &options) {
+	auto frame = make_shared<chat_message>();
+	encode_room_info(encode_string_field(PRoomInformation::kNameFieldNumber, "bench"), 42, payload.data(), payload.size(), 1000, *frame);
+	auto wire = codec == CODEC_FLAT ? flat_codec::encode(frame) : frame;
+
+	serialize_result receive = base;
+	receive.op = "receive";
+	receive.wire_bytes = wire->body_length();
+	const char *body = wire->body();
+	size_t body_length = wire->body_length();
+	const char *information = nullptr;
+	size_t information_size = 0;
+	uint64_t seq = 0;
+	PRoomInformation info;
+	function<bool()> read;
+	if (codec == CODEC_FLAT) {
+		read = [&] {
+			flat_reader reader(body, body_length);
+			const char *name;
+			size_t name_size;
+			seq = reader.uint_field(flat_room_info::seq);
+			return reader.valid() && reader.string_field(flat_room_info::name, name, name_size) &&
+				   reader.string_field(flat_room_info::information, information, information_size);
+		};
+	}
+	else {
+		read = [&] {
+			if (!info.ParseFromArray(body, int(body_length)))
+				return false;
+			information = info.information().data();
+			information_size = info.information().size();
+			seq = info.seq();
+			return true;
+		};
+	}
+	receive.ok = read() && string(information ? information : "", information_size) == payload && seq == 1000;
+	measure(receive, options.count, [&] {
+		read();
+	});
+	print_result(receive, options.format);
+}
+
+/**
+ * @brief 对一种编码、字符集和大小测量客户端编码和服务端解码
+ * @param codec 编码
+ * @param charset 字符集
+ * @param size 聊天内容的字节数
+ * @param options 参数
+ * @return
+ */
+static void bench_codec(int codec, const string &charset, size_t size, const serialize_options &options) {
+	string payload = make_payload(charset, size);
+	string input = "Chat " + payload;
+
+	serialize_result encode;
+	encode.codec = codec_name(codec);
+	encode.op = "encode";
+	encode.charset = charset;
+	encode.size = size;
+	int type = 0;
+	string body;
+	if (!parse_message_as(codec, input, &type, body)) {
+		cerr << "codec " << codec_name(codec) << " cannot encode " << size << " bytes" << endl;
+		return;
+	}
+	encode.wire_bytes = body.size();
+	string scratch;
+	measure(encode, options.count, [&] {
+		parse_message_as(codec, input, &type, scratch);
+	});
+	print_result(encode, options.format);
+
+	serialize_result decode = encode;
+	decode.op = "decode";
+	string information;
+	try {
+		decode.ok = server_decode(codec, body, information) && information == payload;
+	}
+	catch (exception &) {
+		decode.ok = false;
+	}
+	measure(decode, options.count, [&] {
+		try {
+			server_decode(codec, body, information);
+		}
+		catch (exception &) {
+		}
+	});
+	print_result(decode, options.format);
+
+	if (codec == CODEC_PROTOBUF || codec == CODEC_FLAT)
+		bench_receive(codec, decode, payload, options);
+
+	if (codec == CODEC_PROTOBUF) {
+		//handle_message实际使用的零拷贝扫描,不构造PChat
+		serialize_result scan = decode;
+		scan.op = "scan";
+		const char *data = nullptr;
+		size_t data_size = 0;
+		uint64_t room_id = 0;
+		scan.ok = scan_chat_fields(body.data(), body.size(), PChat::kInformationFieldNumber, 0, data, data_size, room_id) &&
+				  string(data, data_size) == payload;
+		measure(scan, options.count, [&] {
+			scan_chat_fields(body.data(), body.size(), PChat::kInformationFieldNumber, 0, data, data_size, room_id);
+		});
+		print_result(scan, options.format);
+	}
+}
+
+/**
+ * @brief 解析编码基准的参数
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[2]开始为选项
+ * @param options 输出
+ * @return bool 是否解析成功
+ */
+static bool parse_serialize_options(int argc, const char *const *argv, serialize_options &options) {
+	for (int i = 2; i < argc; ++i) {
+		string key, value;
+		if (!split_bench_option(argv[i], key, value))
+			return false;
+		stringstream ss(value);
+		string item;
+		if (key == "sizes") {
+			options.sizes.clear();
+			while (getline(ss, item, ','))
+				options.sizes.push_back(strtoul(item.c_str(), nullptr, 10));
+		}
+		else if (key == "charsets") {
+			options.charsets.clear();
+			while (getline(ss, item, ',')) {
+				if (item != "ascii" && item != "cjk" && item != "emoji" && item != "escape")
+					return false;
+				options.charsets.push_back(item);
+			}
+		}
+		else if (key == "codecs") {
+			options.codecs.clear();
+			while (getline(ss, item, ',')) {
+				int codec = codec_from_name(item);
+				if (!codec)
+					return false;
+				options.codecs.push_back(codec);
+			}
+		}
+		else if (key == "count")
+			options.count = atoi(value.c_str());
+		else if (key == "format")
+			options.format = value;
+		else
+			return false;
+	}
+	return !options.sizes.empty() && !options.charsets.empty() && !options.codecs.empty() &&
+		   options.count > 0 && (options.format == "kv" || options.format == "json");
+}
+
+/**
+ * @brief 编码基准: parse_message到parse_message5五种客户端编码,以及服务端对应的解码
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_serialize(int argc, const char *const *argv) {
+	serialize_options options;
+	if (!parse_serialize_options(argc, argv, options)) {
+		cerr << "usage: " << argv[0] << " serialize [options]\n"
+			 << "  client encode (parse_message..5) and server decode per codec, one result per line\n"
+			 << "  --codecs=C,...    raw,text,json,protobuf,flat (default all)\n"
+			 << "  --charsets=C,...  ascii,cjk,emoji,escape (default all)\n"
+			 << "  --sizes=A,B,...   chat payload bytes, at most 256 (default 8,32,128,256)\n"
+			 << "  --count=N         operations per measurement (default 20000)\n"
+			 << "  --format=kv|json  key=value lines or one json object per line (default kv)\n";
+		return 1;
+	}
+
+	for (auto codec : options.codecs) {
+		for (const auto &charset : options.charsets) {
+			for (auto size : options.sizes)
+				bench_codec(codec, charset, size, options);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,321 @@
+﻿#include "chat_bench.h"
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <vector>
+#include <string>
+#include <boost/asio.hpp>
+#include "chat_message.h"
+#include "receive_buffer.h"
+#include "shm_stream.h"
+#include "protocol.pb.h"
+using namespace std;
+using namespace boost::asio::ip;
+
+/**
+ * @brief 传输基准的参数
+ */
+struct transport_options {
+	string host = "127.0.0.1";
+	string port = "8000";
+	string unix_path;
+	string shm_path;
+	//前端代理的地址host:port,给出时额外经过代理跑一轮tcp,与直连对比代理增加的延迟
+	string proxy;
+	//每轮发送的消息数
+	int count = 10000;
+	//同时在途的消息数,1即ping-pong延迟
+	int window = 1;
+	//聊天内容的字节数
+	size_t size = 64;
+	//共享内存环的容量
+	size_t ring_size = shm_segment::default_ring_size;
+};
+
+/**
+ * @brief 一轮基准的结果
+ */
+struct bench_result {
+	int msgs = 0;
+	double elapsed_us = 0;
+	vector<double> latencies_us;
+};
+
+/**
+ * @brief 基准客户端,服务端会把每条聊天广播回发送者,
+ *        保持window条消息在途,按收到回显的时间统计往返延迟
+ *        加入房间时回放的历史消息和其他客户端的消息按名字过滤掉
+ */
+template <typename Stream>
+class bench_client {
+public:
+	bench_client(Stream stream, const string &name, const transport_options &options)
+		: stream_(std::move(stream)), name_(name), options_(options) {
+	}
+
+	/**
+	 * @brief 绑定名字后开始发送,直到收齐count条回显
+	 * @param
+	 * @return
+	 */
+	void start() {
+		PBindName bind_name;
+		bind_name.set_name(name_);
+		send(MT_BIND_NAME, bind_name.SerializeAsString());
+
+		PChat chat;
+		chat.set_information(string(options_.size, 'x'));
+		chat_body_ = chat.SerializeAsString();
+
+		start_time_ = bench_clock::now();
+		for (int i = 0; i < options_.window && sent_ < options_.count; ++i)
+			send_chat();
+		do_read();
+	}
+
+	bench_result &result() {
+		return result_;
+	}
+
+private:
+	void send_chat() {
+		send_times_.push_back(bench_clock::now());
+		++sent_;
+		send(MT_CHAT_INFO, chat_body_);
+	}
+
+	void send(int type, const string &body) {
+		bool write_in_progress = !write_msgs_.empty();
+		write_msgs_.emplace_back();
+		write_msgs_.back().set_message(type, body);
+		if (!write_in_progress)
+			do_write();
+	}
+
+	void do_write() {
+		boost::asio::async_write(stream_,
+			boost::asio::buffer(write_msgs_.front().data(), write_msgs_.front().length()),
+			[this](boost::system::error_code ec, size_t) {
+				if (ec) {
+					if (!finished_)
+						cerr << "write failed: " << ec.message() << endl;
+					return;
+				}
+				write_msgs_.pop_front();
+				if (!write_msgs_.empty())
+					do_write();
+			});
+	}
+
+	void do_read() {
+		stream_.async_read_some(
+			boost::asio::buffer(read_buffer_.write_data(), read_buffer_.write_size()),
+			[this](boost::system::error_code ec, size_t length) {
+				if (ec) {
+					if (!finished_)
+						cerr << "read failed: " << ec.message() << endl;
+					return;
+				}
+				read_buffer_.commit(length);
+				parse_frames(read_buffer_, [this](int type, const char *body, size_t body_length) {
+					if (type == MT_ROOM_INFO && !send_times_.empty() &&
+						room_info_.ParseFromArray(body, int(body_length)) && room_info_.name() == name_)
+						on_echo();
+				});
+				if (result_.msgs < options_.count)
+					do_read();
+				else
+					finish();
+			});
+	}
+
+	void on_echo() {
+		auto now = bench_clock::now();
+		result_.latencies_us.push_back(
+			chrono::duration<double, micro>(now - send_times_.front()).count());
+		send_times_.pop_front();
+		++result_.msgs;
+		if (sent_ < options_.count)
+			send_chat();
+	}
+
+	void finish() {
+		finished_ = true;
+		result_.elapsed_us = chrono::duration<double, micro>(bench_clock::now() - start_time_).count();
+		boost::system::error_code ec;
+		stream_.close(ec);
+	}
+
+private:
+	Stream stream_;
+	string name_;
+	const transport_options &options_;
+	PRoomInformation room_info_;
+	string chat_body_;
+	deque<chat_message> write_msgs_;
+	receive_buffer read_buffer_;
+	deque<bench_clock::time_point> send_times_;
+	bench_clock::time_point start_time_;
+	int sent_ = 0;
+	bool finished_ = false;
+	bench_result result_;
+};
+
+/**
+ * @brief 运行一轮基准并输出一行key=value结果
+ * @param name 传输方式
+ * @param io_service
+ * @param stream 已连接的流
+ * @param options 参数
+ * @return
+ */
+template <typename Stream>
+void run_bench(const char *name, boost::asio::io_service &io_service, Stream stream,
+			   const transport_options &options) {
+	string client_name = string("bench.") + name + "." + to_string(bench_clock::now().time_since_epoch().count());
+	bench_client<Stream> client(std::move(stream), client_name, options);
+	client.start();
+	io_service.run();
+	io_service.restart();
+
+	auto &result = client.result();
+	double seconds = result.elapsed_us / 1e6;
+	cout << "transport=" << name
+		 << " msgs=" << result.msgs
+		 << " size=" << options.size
+		 << " window=" << options.window
+		 << " elapsed_ms=" << result.elapsed_us / 1000
+		 << " msgs_per_sec=" << (seconds > 0 ? result.msgs / seconds : 0)
+		 << " p50_us=" << percentile(result.latencies_us, 0.5)
+		 << " p99_us=" << percentile(result.latencies_us, 0.99)
+		 << " max_us=" << percentile(result.latencies_us, 1.0) << endl;
+}
+
+/**
+ * @brief 依次对loopback tcp、经过代理的tcp、Unix域socket和共享内存环做基准
+ * @param options 参数,未给出路径的传输会被跳过
+ * @return
+ */
+static void bench_transports(const transport_options &options) {
+	boost::asio::io_service io_service;
+
+	tcp::socket tcp_socket(io_service);
+	tcp::resolver resolver(io_service);
+	boost::asio::connect(tcp_socket, resolver.resolve(options.host, options.port));
+	tcp_socket.set_option(tcp::no_delay(true));
+	run_bench("tcp", io_service, std::move(tcp_socket), options);
+
+	if (!options.proxy.empty()) {
+		auto colon = options.proxy.rfind(':');
+		tcp::socket proxy_socket(io_service);
+		boost::asio::connect(proxy_socket,
+			resolver.resolve(options.proxy.substr(0, colon), options.proxy.substr(colon + 1)));
+		proxy_socket.set_option(tcp::no_delay(true));
+		run_bench("proxy", io_service, std::move(proxy_socket), options);
+	}
+
+#ifdef CHAT_SERVER_HAS_SHM
+	using local_stream = boost::asio::local::stream_protocol;
+	if (!options.unix_path.empty()) {
+		local_stream::socket unix_socket(io_service);
+		unix_socket.connect(local_stream::endpoint(options.unix_path));
+		run_bench("unix", io_service, std::move(unix_socket), options);
+	}
+
+	if (!options.shm_path.empty()) {
+		local_stream::socket doorbell(io_service);
+		doorbell.connect(local_stream::endpoint(options.shm_path));
+		chat_message attach;
+		attach.set_message(MT_SHM_ATTACH, to_string(options.ring_size));
+		boost::asio::write(doorbell, boost::asio::buffer(attach.data(), attach.length()));
+		//服务端回复一帧空的MT_SHM_ATTACH,并附带共享内存段的描述符
+		chat_message reply;
+		int fd = -1;
+		boost::system::error_code ec;
+		shm_segment::receive_fd(doorbell.native_handle(), reply.data(), chat_message::header_length, fd, ec);
+		if (!ec && (!reply.decode_header() || reply.type() != MT_SHM_ATTACH || reply.body_length() != 0 || fd < 0))
+			ec = boost::asio::error::invalid_argument;
+		if (ec) {
+			if (fd >= 0)
+				::close(fd);
+			cerr << "attach shared memory failed: " << ec.message() << endl;
+			return;
+		}
+		auto segment = shm_segment::attach(fd, ec);
+		if (ec) {
+			cerr << "map shared memory failed: " << ec.message() << endl;
+			return;
+		}
+		run_bench("shm", io_service, shm_stream(io_service, std::move(doorbell), std::move(segment), false), options);
+	}
+#else
+	if (!options.unix_path.empty() || !options.shm_path.empty())
+		cerr << "unix domain sockets are not supported on this platform" << endl;
+#endif
+}
+
+/**
+ * @brief 解析传输基准的参数
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[2]开始为选项
+ * @param options 输出
+ * @return bool 是否解析成功
+ */
+static bool parse_transport_options(int argc, const char *const *argv, transport_options &options) {
+	for (int i = 2; i < argc; ++i) {
+		string key, value;
+		if (!split_bench_option(argv[i], key, value))
+			return false;
+		if (key == "host")
+			options.host = value;
+		else if (key == "port")
+			options.port = value;
+		else if (key == "unix")
+			options.unix_path = value;
+		else if (key == "shm")
+			options.shm_path = value;
+		else if (key == "proxy") {
+			if (value.find(':') == string::npos)
+				return false;
+			options.proxy = value;
+		}
+		else if (key == "count")
+			options.count = atoi(value.c_str());
+		else if (key == "window")
+			options.window = atoi(value.c_str());
+		else if (key == "size")
+			options.size = strtoul(value.c_str(), nullptr, 10);
+		else if (key == "ring-size")
+			options.ring_size = strtoul(value.c_str(), nullptr, 10);
+		else
+			return false;
+	}
+	return options.count > 0 && options.window > 0;
+}
+
+/**
+ * @brief 传输基准: 经过正在运行的chat_server往返,对比loopback tcp、Unix域socket和共享内存环
+ * @param argc 参数个数
+ * @param argv 参数列表,argv[1]为基准名,argv[2]开始为选项
+ * @return int 进程返回值
+ */
+int bench_transport(int argc, const char *const *argv) {
+	transport_options options;
+	if (!parse_transport_options(argc, argv, options)) {
+		cerr << "usage: " << argv[0] << " transport [options]\n"
+			 << "  round trips through a running chat_server, each client only counts its own echoes\n"
+			 << "  --host=H --port=P loopback tcp endpoint (default 127.0.0.1:8000)\n"
+			 << "  --unix=PATH       also bench the server's --unix socket\n"
+			 << "  --shm=PATH        also bench the server's --shm shared memory transport\n"
+			 << "  --proxy=H:P       also bench tcp through a --backends proxy in front of the server\n"
+			 << "  --count=N         messages per transport (default 10000)\n"
+			 << "  --window=N        messages in flight, 1 measures ping-pong latency (default 1)\n"
+			 << "  --size=N          chat payload bytes (default 64)\n"
+			 << "  --ring-size=N     shared memory ring bytes, power of two, 4096 to 16777216 (default 1048576)\n";
+		return 1;
+	}
+	bench_transports(options);
+	return 0;
+}
@@ -13,6 +13,7 @@
 #include "json_object.h"
 #include "chat_message.h"
 #include "protocol.pb.h"
+#include "flat_message.h"
 #pragma comment(lib, "libboost_exception-vc141-mt-gd-x32-1_72.lib")
 using namespace std;
 using namespace boost::asio::ip;
@@ -25,11 +26,14 @@ public:
 	 * @brief 构造
 	 * @param io_service
 	 * @param endpoint_iterator 对端信息
+	 * @param codec 希望使用的编码,不是protobuf时连接后先协商,服务端回复之前的输入暂存,回复后按选定的编码发送,
+	 *        超时未回复时按protobuf发送
 	 * @return 本类对象
 	 */
 	chat_client(boost::asio::io_service &io_service,
-				tcp::resolver::iterator endpoint_iterator):
-				io_service_(io_service), socket_(io_service){
+				tcp::resolver::iterator endpoint_iterator, int codec = CODEC_PROTOBUF):
+				io_service_(io_service), socket_(io_service), select_timer_(io_service), wanted_codec_(codec),
+				codec_selected_(codec == CODEC_PROTOBUF) {
 		do_connect(endpoint_iterator);
 	}
 
@@ -48,6 +52,21 @@ public:
 		});
 	}
 	
+	/**
+	 * @brief 按本连接协商出的编码编码用户输入并发送,协商完成前先暂存
+	 * @param input 用户输入
+	 * @return
+	 */
+	void write_input(const string &input) {
+		io_service_.post([this, input]() {
+			if (!codec_selected_) {
+				pending_inputs_.push_back(input);
+				return;
+			}
+			send_input(input);
+		});
+	}
+
 	/**
 	 * @brief 关闭本客户端的socket
 	 * @param
@@ -55,11 +74,30 @@ public:
 	 */
 	void close() {
 		io_service_.post([this]() {
+			select_timer_.cancel();
 			socket_.close();
 		});
 	}
 
 private:
+	/**
+	 * @brief 按codec_编码一条用户输入并放入发送队列
+	 * @param input 用户输入
+	 * @return
+	 */
+	void send_input(const string &input) {
+		int type = 0;
+		string output;
+		if (!parse_message_as(codec_, input, &type, output))
+			return;
+		bool write_in_progress = !write_msgs_.empty();
+		write_msgs_.emplace_back();
+		write_msgs_.back().set_message(type, output.data(), output.size());
+		if (!write_in_progress) {
+			do_write();
+		}
+	}
+
 	/**
 	 * @brief 异步连接服务端
 	 * @param endpoint_iterator 对端信息
@@ -71,12 +109,50 @@ private:
 			endpoint_iterator,
 			[this](boost::system::error_code ec, tcp::resolver::iterator) {
 				if (!ec) {
+					if (wanted_codec_ != CODEC_PROTOBUF) {
+						//第一帧必须是协商请求
+						chat_message hello;
+						char codec = char(wanted_codec_);
+						hello.set_message(MT_CODEC_HELLO, &codec, 1);
+						write_msgs_.push_front(hello);
+						if (write_msgs_.size() == 1)
+							do_write();
+						wait_codec_select();
+					}
 					do_read_header();
 				}
 			}
 		);
 	}
 
+	/**
+	 * @brief 等待服务端回复MT_CODEC_SELECT,超时后按protobuf发送暂存的输入
+	 * @param
+	 * @return
+	 */
+	void wait_codec_select() {
+		select_timer_.expires_from_now(std::chrono::milliseconds(codec_select_timeout_ms));
+		select_timer_.async_wait([this](boost::system::error_code ec) {
+			if (ec || codec_selected_)
+				return;
+			std::cout << "client: no codec reply, using " << codec_name(codec_) << "\n";
+			select_codec();
+		});
+	}
+
+	/**
+	 * @brief 编码已确定,协商前暂存的输入按codec_编码发出
+	 * @param
+	 * @return
+	 */
+	void select_codec() {
+		select_timer_.cancel();
+		codec_selected_ = true;
+		for (const auto &input : pending_inputs_)
+			send_input(input);
+		pending_inputs_.clear();
+	}
+
 	/**
 	 * @brief 读取消息头
 	 * @param
@@ -108,18 +184,46 @@ private:
 			boost::asio::buffer(read_msg_.body(), read_msg_.body_length()),
 			[this](boost::system::error_code ec, size_t) {
 				if (!ec) {
+					string name, information;
+					uint64_t room_id = 0, seq = 0;
 					if (read_msg_.type() == MT_ROOM_INFO) {
-						stringstream ss(string(read_msg_.body(), read_msg_.body() + read_msg_.body_length()));
-						PRoomInformation info;
-						auto ok = info.ParseFromString(ss.str());
-						if (ok) {
-							std::cout << "client: '";
-							std::cout << info.name();
+						if (decode_chat(name, information, room_id, seq)) {
+							std::cout << "client: ";
+							if (room_id != 0)
+								std::cout << "[room " << room_id << "] ";
+							if (seq != 0)
+								std::cout << "#" << seq << " ";
+							std::cout << "'";
+							std::cout << name;
 							std::cout << "' says '";
-							std::cout << info.information();
+							std::cout << information;
 							std::cout << "'\n";
 						}
 					}
+					else if (read_msg_.type() == MT_DIRECT_INFO) {
+						if (decode_chat(name, information, room_id, seq))
+							std::cout << "client: [direct] '" << name << "' says '" << information << "'\n";
+					}
+					else if (read_msg_.type() == MT_RESYNC_TOO_FAR) {
+						PResyncTooFar too_far;
+						if (codec_ == CODEC_PROTOBUF &&
+							too_far.ParseFromArray(read_msg_.body(), int(read_msg_.body_length())))
+							std::cout << "client: [room " << too_far.room_id() << "] missed too much after #"
+									  << too_far.last_seq() << ", replaying from #" << too_far.first_seq() << "\n";
+						flat_reader reader(read_msg_.body(), read_msg_.body_length());
+						if (codec_ == CODEC_FLAT && reader.valid())
+							std::cout << "client: [room " << reader.uint_field(flat_resync_too_far::room_id) << "] missed too much after #"
+									  << reader.uint_field(flat_resync_too_far::last_seq) << ", replaying from #"
+									  << reader.uint_field(flat_resync_too_far::first_seq) << "\n";
+						//raw和text编码只有名字和内容,服务端把缺口写成一条说明
+						if ((codec_ == CODEC_RAW || codec_ == CODEC_TEXT) && decode_chat(name, information, room_id, seq))
+							std::cout << "client: " << information << "\n";
+					}
+					else if (read_msg_.type() == MT_CODEC_SELECT && read_msg_.body_length() == 1) {
+						codec_ = static_cast<unsigned char>(read_msg_.body()[0]);
+						std::cout << "client: codec " << codec_name(codec_) << "\n";
+						select_codec();
+					}
 					do_read_header();
 				}
 				else {
@@ -129,6 +233,82 @@ private:
 		);
 	}
 
+	/**
+	 * @brief 按本连接的编码解码聊天消息(MT_ROOM_INFO或MT_DIRECT_INFO),
+	 *        raw和text编码只有名字和内容
+	 * @param name 输出发送者名字
+	 * @param information 输出聊天内容
+	 * @param room_id 输出房间id
+	 * @param seq 输出房间内的序号
+	 * @return bool 是否解码成功
+	 */
+	bool decode_chat(string &name, string &information, uint64_t &room_id, uint64_t &seq) {
+		const char *body = read_msg_.body();
+		size_t body_length = read_msg_.body_length();
+		if (codec_ == CODEC_FLAT) {
+			//字段直接在read_msg_上读取,越界或版本不符时整帧丢弃
+			flat_reader reader(body, body_length);
+			if (!reader.valid() || !reader.string_field(flat_room_info::name, name) ||
+				!reader.string_field(flat_room_info::information, information))
+				return false;
+			room_id = reader.uint_field(flat_room_info::room_id);
+			seq = reader.uint_field(flat_room_info::seq);
+			return true;
+		}
+		try {
+			if (codec_ == CODEC_RAW) {
+				RoomInfomation info;
+				if (body_length != sizeof(info))
+					return false;
+				memcpy(&info, body, sizeof(info));
+				if (info.name_.name_len < 0 || size_t(info.name_.name_len) > sizeof(info.name_.name) ||
+					info.chat_.infomation_len < 0 || size_t(info.chat_.infomation_len) > sizeof(info.chat_.infomation))
+					return false;
+				name.assign(info.name_.name, info.name_.name_len);
+				information.assign(info.chat_.infomation, info.chat_.infomation_len);
+				return true;
+			}
+			if (codec_ == CODEC_TEXT) {
+				stringstream ss(string(body, body + body_length));
+				boost::archive::text_iarchive ia(ss);
+				SRoomInfo info;
+				ia & info;
+				name = info.name();
+				information = info.info();
+				return true;
+			}
+			if (codec_ == CODEC_JSON) {
+				stringstream ss(string(body, body + body_length));
+				ptree tree;
+				boost::property_tree::read_json(ss, tree);
+				name = tree.get<string>("name");
+				information = tree.get<string>("information");
+				room_id = tree.get<uint64_t>("room_id", 0);
+				seq = tree.get<uint64_t>("seq", 0);
+				return true;
+			}
+		}
+		catch (exception &) {
+			return false;
+		}
+		if (read_msg_.type() == MT_DIRECT_INFO) {
+			PDirectInformation info;
+			if (!info.ParseFromArray(body, int(body_length)))
+				return false;
+			name = info.name();
+			information = info.information();
+			return true;
+		}
+		PRoomInformation info;
+		if (!info.ParseFromArray(body, int(body_length)))
+			return false;
+		name = info.name();
+		information = info.information();
+		room_id = info.room_id();
+		seq = info.seq();
+		return true;
+	}
+
 	/**
 	 * @brief 将要发送的消息一直发送直至没有消息发送
 	 * @param
@@ -153,10 +333,21 @@ private:
 		);
 	}
 private:
+	//等待服务端回复编码的时间(毫秒),应长于服务端的协商等待时间
+	enum { codec_select_timeout_ms = 2000 };
+
 	boost::asio::io_service &io_service_;
 	tcp::socket socket_;
+	boost::asio::steady_timer select_timer_;
 	chat_message read_msg_;
 	chat_message_queue write_msgs_;
+	//希望使用的编码和服务端确认的编码,确认之前使用protobuf
+	int wanted_codec_;
+	int codec_ = CODEC_PROTOBUF;
+	//服务端是否已确认编码,protobuf不需要协商
+	bool codec_selected_;
+	//确认编码之前的用户输入
+	vector<string> pending_inputs_;
 };
 
 int main(int argc, const char* const* argv) {
@@ -168,6 +359,11 @@ int main(int argc, const char* const* argv) {
 	if (argc > 3) {
 		port = argv[2];
 	}
+	//第三个参数为编码: raw/text/json/protobuf/flat
+	int codec = CODEC_PROTOBUF;
+	if (argc > 3 && codec_from_name(argv[3])) {
+		codec = codec_from_name(argv[3]);
+	}
 	try {
 		GOOGLE_PROTOBUF_VERIFY_VERSION;
 		boost::asio::io_service io_service;
@@ -176,20 +372,19 @@ int main(int argc, const char* const* argv) {
 		vector<unique_ptr<chat_client>> client_group;
 
 		for (int i = 0; i < 5; ++i) {
-			client_group.emplace_back(make_unique<chat_client>(io_service, endpoint_iterator));
+			client_group.emplace_back(make_unique<chat_client>(io_service, endpoint_iterator, codec));
 		}
-		this_thread::sleep_for(1000ms);
+		//连接建立后马上处理,协商请求要在服务端的等待时间内发出
 		thread t([&io_service]() { io_service.run(); });
-		char line[chat_message::max_body_length + 1] = { 0 };
-		while (std::cin.getline(line, chat_message::max_body_length + 1)) {
-			chat_message msg;
-			auto type = 0;
-			string input(line, line + strlen(line));
+		this_thread::sleep_for(1000ms);
+		string input;
+		while (std::getline(std::cin, input)) {
+			//每个客户端按自己协商出的编码编码
+			int type = 0;
 			string output;
-			if (parse_message4(input, &type, output)) {
-				msg.set_message(type, output.data(), output.size());
+			if (parse_message_as(codec, input, &type, output)) {
 				for (auto &c : client_group)
-					c->write(msg);
+					c->write_input(input);
 				cout << "write message for server " << output.size() << endl;
 			}
 		}
@@ -0,0 +1,101 @@
+﻿#pragma once
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 按大小分级的内存池,块大小为64/256/1K/4K/64K
+ *        每个线程有自己的空闲链表,分配和释放不加锁;超过最大级别的块直接new/delete
+ */
+class buffer_pool {
+public:
+	enum { class_count = 5 };
+	//每个线程每个级别最多缓存的字节数,超出的块直接归还给系统
+	enum { max_cached_bytes = 1024 * 1024 };
+
+	/**
+	 * @brief 获取size对应的级别
+	 * @param size 需要的字节数
+	 * @return int 级别下标,超过最大级别时返回-1
+	 */
+	static int size_class(size_t size) {
+		for (int i = 0; i < class_count; ++i) {
+			if (size <= class_size(i))
+				return i;
+		}
+		return -1;
+	}
+
+	/**
+	 * @brief 获取级别对应的块大小
+	 * @param index 级别下标
+	 * @return size_t 块大小
+	 */
+	static size_t class_size(int index) {
+		static const size_t sizes[class_count] = { 64, 256, 1024, 4 * 1024, 64 * 1024 };
+		return sizes[index];
+	}
+
+	/**
+	 * @brief 分配一块至少size字节的内存
+	 * @param size 需要的字节数
+	 * @param capacity 输出实际的块大小,释放时需要原样传回
+	 * @return char* 内存块
+	 */
+	static char *allocate(size_t size, size_t &capacity) {
+		int index = size_class(size);
+		if (index < 0) {
+			capacity = size;
+			return new char[size];
+		}
+		capacity = class_size(index);
+		auto &blocks = local_lists()[index];
+		if (blocks.empty())
+			return new char[capacity];
+		char *block = blocks.back();
+		blocks.pop_back();
+		return block;
+	}
+
+	/**
+	 * @brief 释放allocate分配的内存块
+	 * @param block 内存块
+	 * @param capacity allocate输出的块大小
+	 * @return
+	 */
+	static void deallocate(char *block, size_t capacity) {
+		if (!block)
+			return;
+		int index = size_class(capacity);
+		if (index < 0 || class_size(index) != capacity) {
+			delete[] block;
+			return;
+		}
+		auto &blocks = local_lists()[index];
+		if ((blocks.size() + 1) * capacity > max_cached_bytes) {
+			delete[] block;
+			return;
+		}
+		blocks.push_back(block);
+	}
+
+private:
+	struct free_lists {
+		std::vector<char *> lists[class_count];
+
+		std::vector<char *> &operator[](int index) {
+			return lists[index];
+		}
+
+		~free_lists() {
+			for (auto &blocks : lists) {
+				for (auto block : blocks)
+					delete[] block;
+			}
+		}
+	};
+
+	static free_lists &local_lists() {
+		thread_local free_lists lists;
+		return lists;
+	}
+};
@@ -0,0 +1,428 @@
+﻿#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "serialize_object.h"
+#include "json_object.h"
+#include "protocol.pb.h"
+#include "chat_message.h"
+#include "chat_history.h"
+#include "protobuf_codec.h"
+#include "flat_message.h"
+#include "room_registry.h"
+
+/**
+ * @brief 编码协商的参数
+ */
+struct codec_options {
+	//允许客户端选择的编码,(1 << CodecType)的组合,protobuf总是允许
+	unsigned allowed = 1u << CODEC_PROTOBUF;
+	//协商时等待客户端第一帧的时间(毫秒),超时或第一帧不是MT_CODEC_HELLO时按protobuf处理
+	int handshake_timeout_ms = 200;
+
+	/**
+	 * @brief 是否需要协商,只允许protobuf时连接建立后直接开始会话
+	 * @param
+	 * @return bool
+	 */
+	bool handshake() const {
+		return (allowed & ~(1u << CODEC_PROTOBUF)) != 0;
+	}
+
+	bool allows(int codec) const {
+		return codec >= CODEC_RAW && codec <= CODEC_FLAT && (allowed & (1u << codec)) != 0;
+	}
+};
+
+/**
+ * @brief 按客户端的偏好选择编码
+ * @param options 协商参数
+ * @param body MT_CODEC_HELLO的消息体,每字节一个CodecType
+ * @param body_length 消息体长度
+ * @return int 第一个允许的编码,都不允许时为CODEC_PROTOBUF
+ */
+inline int choose_codec(const codec_options &options, const char *body, size_t body_length) {
+	for (size_t i = 0; i < body_length; ++i) {
+		if (options.allows(static_cast<unsigned char>(body[i])))
+			return static_cast<unsigned char>(body[i]);
+	}
+	return CODEC_PROTOBUF;
+}
+
+/**
+ * @brief 服务端内部的聊天帧(protobuf编码的MT_ROOM_INFO或MT_DIRECT_INFO)解出的字段,
+ *        字符串在本线程的Arena上,只在message_arena::scope之内有效
+ */
+struct outgoing_chat {
+	const std::string *name = nullptr;
+	const std::string *information = nullptr;
+	uint64_t room_id = 0;
+	uint64_t seq = 0;
+	//MT_RESYNC_TOO_FAR转换成的说明,information指向它
+	std::string notice;
+
+	/**
+	 * @brief 解码一个发往客户端的聊天帧,MT_RESYNC_TOO_FAR转换成名字为空的一条说明,
+	 *        只有名字和内容的编码(raw/text)也能告诉客户端历史被截断
+	 * @param msg 消息帧
+	 * @return bool 不是聊天帧或解码失败时返回false
+	 */
+	bool parse(const chat_message &msg) {
+		if (msg.type() == MT_ROOM_INFO) {
+			auto info = parse_on_arena<PRoomInformation>(msg.body(), msg.body_length());
+			if (!info)
+				return false;
+			name = &info->name();
+			information = &info->information();
+			room_id = info->room_id();
+			seq = info->seq();
+			return true;
+		}
+		if (msg.type() == MT_DIRECT_INFO) {
+			auto info = parse_on_arena<PDirectInformation>(msg.body(), msg.body_length());
+			if (!info)
+				return false;
+			name = &info->name();
+			information = &info->information();
+			return true;
+		}
+		if (msg.type() == MT_RESYNC_TOO_FAR) {
+			static const std::string no_name;
+			auto too_far = parse_on_arena<PResyncTooFar>(msg.body(), msg.body_length());
+			if (!too_far)
+				return false;
+			room_id = too_far->room_id();
+			notice = "room " + std::to_string(room_id) + ": missed too much after #" + std::to_string(too_far->last_seq()) +
+					 ", replaying from #" + std::to_string(too_far->first_seq());
+			name = &no_name;
+			information = &notice;
+			return true;
+		}
+		return false;
+	}
+};
+
+/**
+ * @brief 编码策略,chat_session按编码实例化,收发路径上没有虚函数分派
+ *        decode把客户端的消息体解码后调用chat_handler的绑定、发言等接口,
+ *        encode把服务端内部protobuf编码的消息帧转换成客户端的编码,返回nullptr表示该客户端不接收这种消息,
+ *        房间广播的消息帧所有成员共享,每种编码由第一个需要它的接收者转换一次,结果缓存在帧上供同编码的成员共享
+ */
+
+/**
+ * @brief protobuf,不协商的客户端的默认编码,与服务端内部的编码相同,收发都不需要转换
+ */
+struct protobuf_codec {
+	enum { id = CODEC_PROTOBUF };
+
+	static const char *name() {
+		return "protobuf";
+	}
+
+	template <typename Handler>
+	static void decode(Handler &handler, int type, const char *body, size_t body_length) {
+		handler.handle_message(type, body, body_length);
+	}
+
+	static const chat_message_ptr &encode(const chat_message_ptr &msg) {
+		return msg;
+	}
+};
+
+/**
+ * @brief parse_message的定长结构体,只有绑定名字和大厅聊天,
+ *        发往客户端的聊天帧是RoomInfomation,名字和内容超过结构体容量的部分被截断
+ */
+struct raw_codec {
+	enum { id = CODEC_RAW };
+
+	static const char *name() {
+		return "raw";
+	}
+
+	template <typename Handler>
+	static void decode(Handler &handler, int type, const char *body, size_t body_length) {
+		if (type == MT_BIND_NAME && body_length == sizeof(BindName)) {
+			BindName bind_name;
+			memcpy(&bind_name, body, sizeof(bind_name));
+			if (bind_name.name_len >= 0 && size_t(bind_name.name_len) <= sizeof(bind_name.name) &&
+				valid_utf8(bind_name.name, size_t(bind_name.name_len)))
+				handler.rebind_name(std::string(bind_name.name, bind_name.name_len));
+		}
+		else if (type == MT_CHAT_INFO && body_length == sizeof(ChatInformation)) {
+			ChatInformation chat;
+			memcpy(&chat, body, sizeof(chat));
+			if (chat.infomation_len >= 0 && size_t(chat.infomation_len) <= sizeof(chat.infomation) &&
+				valid_utf8(chat.infomation, size_t(chat.infomation_len)))
+				handler.post(room_registry::lobby_room_id, chat.infomation, size_t(chat.infomation_len));
+		}
+	}
+
+	static chat_message_ptr encode(const chat_message_ptr &msg) {
+		return msg->transcode(id, [&msg] { return convert(*msg); });
+	}
+
+	/**
+	 * @brief 转换一帧,由encode调用,每帧每种编码只调用一次
+	 * @param msg 服务端内部protobuf编码的消息帧
+	 * @return chat_message_ptr 不接收这种消息时返回nullptr
+	 */
+	static chat_message_ptr convert(const chat_message &msg) {
+		message_arena::scope arena_scope;
+		outgoing_chat chat;
+		if (!chat.parse(msg))
+			return nullptr;
+		RoomInfomation info;
+		memset(&info, 0, sizeof(info));
+		size_t name_len = std::min(chat.name->size(), sizeof(info.name_.name));
+		memcpy(info.name_.name, chat.name->data(), name_len);
+		info.name_.name_len = int(name_len);
+		size_t information_len = std::min(chat.information->size(), sizeof(info.chat_.infomation));
+		memcpy(info.chat_.infomation, chat.information->data(), information_len);
+		info.chat_.infomation_len = int(information_len);
+		auto out = std::make_shared<chat_message>();
+		out->set_message(msg.type(), &info, sizeof(info));
+		return out;
+	}
+};
+
+/**
+ * @brief parse_message2的boost text_archive,只有绑定名字和大厅聊天,发往客户端的聊天帧是SRoomInfo
+ */
+struct text_codec {
+	enum { id = CODEC_TEXT };
+
+	static const char *name() {
+		return "text";
+	}
+
+	template <typename Handler>
+	static void decode(Handler &handler, int type, const char *body, size_t body_length) {
+		if (type == MT_BIND_NAME) {
+			SBindName bind_name;
+			if (load(body, body_length, bind_name) && valid_utf8(bind_name.bind_name()))
+				handler.rebind_name(bind_name.bind_name());
+		}
+		else if (type == MT_CHAT_INFO) {
+			SChatInfo chat;
+			if (load(body, body_length, chat) && valid_utf8(chat.chat_information()))
+				handler.post(room_registry::lobby_room_id, chat.chat_information().data(), chat.chat_information().size());
+		}
+	}
+
+	static chat_message_ptr encode(const chat_message_ptr &msg) {
+		return msg->transcode(id, [&msg] { return convert(*msg); });
+	}
+
+	/**
+	 * @brief 转换一帧,由encode调用,每帧每种编码只调用一次
+	 * @param msg 服务端内部protobuf编码的消息帧
+	 * @return chat_message_ptr 不接收这种消息时返回nullptr
+	 */
+	static chat_message_ptr convert(const chat_message &msg) {
+		message_arena::scope arena_scope;
+		outgoing_chat chat;
+		if (!chat.parse(msg))
+			return nullptr;
+		std::stringstream ss;
+		{
+			boost::archive::text_oarchive oa(ss);
+			SRoomInfo info(*chat.name, *chat.information);
+			oa & info;
+		}
+		auto out = std::make_shared<chat_message>();
+		std::string body = ss.str();
+		if (body.size() > chat_message::max_body_length())
+			return nullptr;
+		out->set_message(msg.type(), body);
+		return out;
+	}
+
+private:
+	/**
+	 * @brief 从消息体读取一个对象,消息体不完整或格式错误时返回false
+	 */
+	template <typename T>
+	static bool load(const char *body, size_t body_length, T &t) {
+		try {
+			std::stringstream ss(std::string(body, body + body_length));
+			boost::archive::text_iarchive ia(ss);
+			ia & t;
+			return true;
+		}
+		catch (std::exception &) {
+			return false;
+		}
+	}
+};
+
+/**
+ * @brief parse_message3的ptree json,除绑定名字和大厅聊天外也接受房间和私聊消息,
+ *        字段名与protocol.proto中的字段名相同
+ */
+struct json_codec {
+	enum { id = CODEC_JSON };
+
+	static const char *name() {
+		return "json";
+	}
+
+	template <typename Handler>
+	static void decode(Handler &handler, int type, const char *body, size_t body_length) {
+		try {
+			ptree tree;
+			std::stringstream ss(std::string(body, body + body_length));
+			boost::property_tree::read_json(ss, tree);
+			if (type == MT_BIND_NAME) {
+				auto name = tree.get<std::string>("name");
+				if (valid_utf8(name))
+					handler.rebind_name(name);
+			}
+			else if (type == MT_CHAT_INFO || type == MT_ROOM_CHAT) {
+				auto information = tree.get<std::string>("information");
+				if (!valid_utf8(information))
+					return;
+				uint64_t room_id = type == MT_CHAT_INFO ? uint64_t(room_registry::lobby_room_id) : tree.get<uint64_t>("room_id");
+				handler.post(room_id, information.data(), information.size());
+			}
+			else if (type == MT_JOIN_ROOM) {
+				handler.join(tree.get<uint64_t>("room_id"), tree.get<uint64_t>("last_seq", 0));
+			}
+			else if (type == MT_LEAVE_ROOM) {
+				handler.leave(tree.get<uint64_t>("room_id"));
+			}
+			else if (type == MT_DIRECT_CHAT) {
+				auto to = tree.get<std::string>("to");
+				auto information = tree.get<std::string>("information");
+				if (valid_utf8(to) && valid_utf8(information))
+					handler.direct(to, information);
+			}
+		}
+		catch (std::exception &) {
+		}
+	}
+
+	static chat_message_ptr encode(const chat_message_ptr &msg) {
+		return msg->transcode(id, [&msg] { return convert(*msg); });
+	}
+
+	/**
+	 * @brief 转换一帧,由encode调用,每帧每种编码只调用一次
+	 * @param msg 服务端内部protobuf编码的消息帧
+	 * @return chat_message_ptr 不接收这种消息时返回nullptr
+	 */
+	static chat_message_ptr convert(const chat_message &msg) {
+		message_arena::scope arena_scope;
+		ptree tree;
+		if (msg.type() == MT_RESYNC_TOO_FAR) {
+			auto too_far = parse_on_arena<PResyncTooFar>(msg.body(), msg.body_length());
+			if (!too_far)
+				return nullptr;
+			tree.put("room_id", too_far->room_id());
+			tree.put("last_seq", too_far->last_seq());
+			tree.put("first_seq", too_far->first_seq());
+		}
+		else {
+			outgoing_chat chat;
+			if (!chat.parse(msg))
+				return nullptr;
+			tree.put("name", *chat.name);
+			tree.put("information", *chat.information);
+			if (msg.type() == MT_ROOM_INFO) {
+				tree.put("room_id", chat.room_id);
+				tree.put("seq", chat.seq);
+			}
+		}
+		std::string body = ptree_to_json_string(tree);
+		if (body.size() > chat_message::max_body_length())
+			return nullptr;
+		auto out = std::make_shared<chat_message>();
+		out->set_message(msg.type(), body);
+		return out;
+	}
+};
+
+/**
+ * @brief flat_message.h的定长布局,消息类型与protobuf相同,客户端收到聊天帧后原地读取字段,
+ *        服务端解码时聊天内容直接从接收缓冲区交给房间,不经过中间对象
+ */
+struct flat_codec {
+	enum { id = CODEC_FLAT };
+
+	static const char *name() {
+		return "flat";
+	}
+
+	template <typename Handler>
+	static void decode(Handler &handler, int type, const char *body, size_t body_length) {
+		flat_reader reader(body, body_length);
+		if (!reader.valid())
+			return;
+		const char *data, *information;
+		size_t size, information_size;
+		if (type == MT_BIND_NAME) {
+			if (reader.string_field(flat_bind_name::name, data, size) && valid_utf8(data, size))
+				handler.rebind_name(std::string(data ? data : "", size));
+		}
+		else if (type == MT_CHAT_INFO || type == MT_ROOM_CHAT) {
+			if (!reader.string_field(flat_chat::information, information, information_size) ||
+				!valid_utf8(information, information_size))
+				return;
+			uint64_t room_id = type == MT_CHAT_INFO ? uint64_t(room_registry::lobby_room_id) : reader.uint_field(flat_chat::room_id);
+			handler.post(room_id, information ? information : "", information_size);
+		}
+		else if (type == MT_JOIN_ROOM) {
+			handler.join(reader.uint_field(flat_join_room::room_id), reader.uint_field(flat_join_room::last_seq));
+		}
+		else if (type == MT_LEAVE_ROOM) {
+			handler.leave(reader.uint_field(flat_join_room::room_id));
+		}
+		else if (type == MT_DIRECT_CHAT) {
+			if (reader.string_field(flat_direct_chat::to, data, size) &&
+				reader.string_field(flat_direct_chat::information, information, information_size) &&
+				valid_utf8(data, size) && valid_utf8(information, information_size))
+				handler.direct(std::string(data ? data : "", size), std::string(information ? information : "", information_size));
+		}
+	}
+
+	static chat_message_ptr encode(const chat_message_ptr &msg) {
+		return msg->transcode(id, [&msg] { return convert(*msg); });
+	}
+
+	/**
+	 * @brief 转换一帧,由encode调用,每帧每种编码只调用一次
+	 * @param msg 服务端内部protobuf编码的消息帧
+	 * @return chat_message_ptr 不接收这种消息时返回nullptr
+	 */
+	static chat_message_ptr convert(const chat_message &msg) {
+		message_arena::scope arena_scope;
+		auto out = std::make_shared<chat_message>();
+		if (msg.type() == MT_RESYNC_TOO_FAR) {
+			auto too_far = parse_on_arena<PResyncTooFar>(msg.body(), msg.body_length());
+			if (!too_far)
+				return nullptr;
+			flat_builder builder(out->prepare_message(msg.type(), flat_builder::body_size(flat_resync_too_far::field_count, 0)),
+								 flat_resync_too_far::field_count);
+			builder.set_uint(flat_resync_too_far::room_id, too_far->room_id());
+			builder.set_uint(flat_resync_too_far::last_seq, too_far->last_seq());
+			builder.set_uint(flat_resync_too_far::first_seq, too_far->first_seq());
+			return out;
+		}
+		outgoing_chat chat;
+		if (!chat.parse(msg))
+			return nullptr;
+		size_t size = flat_builder::body_size(flat_room_info::field_count, chat.name->size() + chat.information->size());
+		if (size > chat_message::max_body_length())
+			return nullptr;
+		flat_builder builder(out->prepare_message(msg.type(), size), flat_room_info::field_count);
+		builder.set_string(flat_room_info::name, *chat.name);
+		builder.set_string(flat_room_info::information, *chat.information);
+		builder.set_uint(flat_room_info::room_id, chat.room_id);
+		builder.set_uint(flat_room_info::seq, chat.seq);
+		return out;
+	}
+};
@@ -0,0 +1,280 @@
+﻿#pragma once
+#include <memory>
+#include <set>
+#include <string>
+#include <sstream>
+#include "serialize_object.h"
+#include "json_object.h"
+#include "protocol.pb.h"
+#include "protobuf_codec.h"
+#include "chat_message.h"
+#include "chat_room.h"
+#include "room_registry.h"
+#include "server_stats.h"
+#include "session_directory.h"
+
+/**
+ * @brief 客户端消息的协议处理,与传输方式无关,每个客户端连接持有一个
+ *        记录连接加入的房间和绑定的名字,连接断开时统一离开并解绑
+ *        handle_message直接处理protobuf消息体,其他编码由chat_codec.h中的编码解码后调用绑定、发言等公开接口
+ */
+class chat_handler {
+public:
+	chat_handler(room_registry &rooms, session_directory &names)
+		: rooms_(rooms), names_(names) {
+	}
+
+	/**
+	 * @brief 连接建立,默认加入大厅
+	 * @param self 本连接对应的房间成员
+	 * @return
+	 */
+	void start(const chat_participant_ptr &self) {
+		self_ = self;
+		if (rooms_.options().lobby_auto_join)
+			join(room_registry::lobby_room_id, 0);
+	}
+
+	/**
+	 * @brief 连接断开,离开所有已加入的房间并解绑名字,可重复调用
+	 * @param
+	 * @return
+	 */
+	void stop() {
+		auto self = self_.lock();
+		if (self) {
+			for (auto room_id : joined_rooms_)
+				rooms_.leave(room_id, self);
+		}
+		joined_rooms_.clear();
+		unbind_name();
+		self_.reset();
+	}
+
+	/**
+	 * @brief 根据读到的消息反序列化程指定的类
+	 * @param body 消息体
+	 * @param body_length 消息体长度
+	 * @return T 自定义类型
+	 */
+	template<typename T>
+	static T serialize_object(const char *body, size_t body_length) {
+		T t;
+		std::stringstream ss(std::string(body, body + body_length));
+		boost::archive::text_iarchive ia(ss);
+		ia & t;
+		return t;
+	}
+
+	/**
+	 * @brief 将收到的消息体转换为ptree，认为是json
+	 * @param body 消息体
+	 * @param body_length 消息体长度
+	 * @return
+	 */
+	static ptree to_ptree(const char *body, size_t body_length) {
+		ptree obj;
+		std::stringstream ss(std::string(body, body + body_length));
+		boost::property_tree::read_json(ss, obj);
+		return obj;
+	}
+
+	/**
+	 * @brief 使用protobuf解析消息,直接读取消息体,不复制
+	 * @param msg 输出的protobuf消息
+	 * @param body 消息体
+	 * @param body_length 消息体长度
+	 * @return
+	 */
+	static bool fill_protobuf(::google::protobuf::Message *msg, const char *body, size_t body_length) {
+		return parse_protobuf(msg, body, body_length);
+	}
+
+	/**
+	 * @brief 根据消息类型处理消息
+	 * @param type 消息类型
+	 * @param body 消息体
+	 * @param body_length 消息体长度
+	 * @return
+	 */
+	void handle_message(int type, const char *body, size_t body_length) {
+		//解码出的protobuf对象都在本线程的Arena上,处理完这条消息后一起释放
+		message_arena::scope arena_scope;
+		if (type == MT_BIND_NAME) {
+			auto bind_name = parse_on_arena<PBindName>(body, body_length);
+			if (bind_name && valid_utf8(bind_name->name())) {
+				rebind_name(bind_name->name());
+			}
+		}
+		else if (type == MT_CHAT_INFO) {
+			const char *information;
+			size_t information_size;
+			uint64_t room_id = room_registry::lobby_room_id;
+			if (scan_chat_fields(body, body_length, PChat::kInformationFieldNumber, 0,
+								 information, information_size, room_id)) {
+				post(room_id, information, information_size);
+			}
+		}
+		else if (type == MT_JOIN_ROOM) {
+			PJoinRoom join_room;
+			if (fill_protobuf(&join_room, body, body_length))
+				join(join_room.room_id(), join_room.last_seq());
+		}
+		else if (type == MT_LEAVE_ROOM) {
+			PLeaveRoom leave_room;
+			if (fill_protobuf(&leave_room, body, body_length))
+				leave(leave_room.room_id());
+		}
+		else if (type == MT_DIRECT_CHAT) {
+			auto chat = parse_on_arena<PDirectChat>(body, body_length);
+			if (chat && valid_utf8(chat->to()) && valid_utf8(chat->information()))
+				direct(chat->to(), chat->information());
+		}
+		else if (type == MT_ROOM_CHAT) {
+			const char *information;
+			size_t information_size;
+			uint64_t room_id = 0;
+			if (scan_chat_fields(body, body_length, PRoomChat::kInformationFieldNumber, PRoomChat::kRoomIdFieldNumber,
+								 information, information_size, room_id)) {
+				post(room_id, information, information_size);
+			}
+		}
+		else if (type == MT_CODEC_HELLO) {
+			//未开启协商、握手超时或第一帧不是协商请求时,协商请求落到protobuf会话中,回复protobuf,客户端不必一直等待
+			select_protobuf();
+		}
+		else {
+
+		}
+	}
+
+	/**
+	 * @brief 根据绑定好的名字构造一个聊天室信息,把绑定名字时编码好的名字字段和聊天内容直接拼进消息帧
+	 * @param room_id 消息所在的房间
+	 * @param information 聊天内容
+	 * @param information_size 聊天内容的字节数
+	 * @param msg 输出的消息帧
+	 * @return bool 超过消息体上限时返回false
+	 */
+	bool build_room_info(uint64_t room_id, const char *information, size_t information_size, chat_message &msg) {
+		//序号由房间在广播前原地写入
+		return encode_room_info(name_field_, room_id, information, information_size, chat_room::unstamped_seq, msg);
+	}
+
+	/**
+	 * @brief 绑定名字,名字同时用于标注发言和私聊寻址,
+	 *        名字已被其他在线客户端占用时仍用于标注发言,但私聊发给原来的客户端
+	 * @param name 名字
+	 * @return
+	 */
+	void rebind_name(const std::string &name) {
+		if (name == bind_name_string_ && name_bound_)
+			return;
+		unbind_name();
+		bind_name_string_ = name;
+		name_field_ = encode_string_field(PRoomInformation::kNameFieldNumber, name);
+		auto self = self_.lock();
+		name_bound_ = self && !name.empty() && names_.bind(name, self);
+	}
+
+	/**
+	 * @brief 私聊,直接放入目标客户端的发送队列,不经过任何房间
+	 * @param to 目标绑定的名字
+	 * @param information 聊天内容
+	 * @return
+	 */
+	void direct(const std::string &to, const std::string &information) {
+		auto target = names_.find(to);
+		server_stats::instance().record_direct(target != nullptr);
+		if (!target)
+			return;
+		message_arena::scope arena_scope;
+		auto info = message_arena::create<PDirectInformation>();
+		info->set_name(bind_name_string_);
+		info->set_information(information);
+		auto msg = std::make_shared<chat_message>();
+		if (serialize_protobuf(*info, MT_DIRECT_INFO, *msg))
+			target->deliver(chat_message_ptr(std::move(msg)));
+	}
+
+	/**
+	 * @brief 加入房间,已加入或达到上限时忽略
+	 * @param room_id 房间id
+	 * @param last_seq 客户端在该房间最后收到的序号,0表示重放全部历史
+	 * @return
+	 */
+	void join(uint64_t room_id, uint64_t last_seq) {
+		auto self = self_.lock();
+		if (!self || joined_rooms_.size() >= max_joined_rooms)
+			return;
+		if (joined_rooms_.insert(room_id).second)
+			rooms_.join(room_id, self, last_seq);
+	}
+
+	/**
+	 * @brief 离开房间,未加入时忽略
+	 * @param room_id 房间id
+	 * @return
+	 */
+	void leave(uint64_t room_id) {
+		auto self = self_.lock();
+		if (self && joined_rooms_.erase(room_id))
+			rooms_.leave(room_id, self);
+	}
+
+	/**
+	 * @brief 向已加入的房间广播聊天内容
+	 * @param room_id 房间id
+	 * @param information 聊天内容
+	 * @param information_size 聊天内容的字节数
+	 * @return
+	 */
+	void post(uint64_t room_id, const char *information, size_t information_size) {
+		if (!joined_rooms_.count(room_id))
+			return;
+		auto msg = std::make_shared<chat_message>();
+		if (build_room_info(room_id, information, information_size, *msg))
+			rooms_.deliver(room_id, msg);
+	}
+
+private:
+	/**
+	 * @brief 回复MT_CODEC_SELECT,告知客户端本连接使用protobuf
+	 * @param
+	 * @return
+	 */
+	void select_protobuf() {
+		auto self = self_.lock();
+		if (!self)
+			return;
+		char codec = char(CODEC_PROTOBUF);
+		auto msg = std::make_shared<chat_message>();
+		msg->set_message(MT_CODEC_SELECT, &codec, 1);
+		self->deliver(chat_message_ptr(std::move(msg)));
+	}
+
+	/**
+	 * @brief 解绑当前的名字,未绑定时忽略
+	 * @param
+	 * @return
+	 */
+	void unbind_name() {
+		if (name_bound_)
+			names_.unbind(bind_name_string_, self_);
+		name_bound_ = false;
+	}
+
+private:
+	//每个连接最多同时加入的房间数
+	enum { max_joined_rooms = 256 };
+
+	room_registry &rooms_;
+	session_directory &names_;
+	std::weak_ptr<chat_participant> self_;
+	std::set<uint64_t> joined_rooms_;
+	std::string bind_name_string_;
+	//bind_name_string_是否在names_中绑定到本连接
+	bool name_bound_ = false;
+	//bind_name_string_按PRoomInformation的name字段编码好的字节,构造聊天室信息时原样拷贝
+	std::string name_field_;
+};
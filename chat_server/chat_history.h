@@ -0,0 +1,75 @@
+﻿#pragma once
+#include <memory>
+#include <vector>
+#include "chat_message.h"
+
+using chat_message_ptr = std::shared_ptr<const chat_message>;
+using chat_message_batch = std::vector<chat_message_ptr>;
+using chat_message_batch_ptr = std::shared_ptr<const chat_message_batch>;
+
+/**
+ * @brief 房间历史,容量固定的环形缓冲区,保存最近的共享消息帧,满了之后覆盖最早的一条
+ *        加入时重放的消息批按需生成并缓存,历史不变期间所有加入者共享同一批
+ */
+class chat_history {
+public:
+	/**
+	 * @brief 构造
+	 * @param depth 保留的消息条数,0表示不保留历史
+	 * @return 本类对象
+	 */
+	explicit chat_history(size_t depth)
+		: frames_(depth) {
+	}
+
+	/**
+	 * @brief 追加一条消息
+	 * @param msg 编码好的共享消息帧
+	 * @return
+	 */
+	void push(const chat_message_ptr &msg) {
+		if (frames_.empty())
+			return;
+		if (size_ < frames_.size()) {
+			frames_[(head_ + size_) % frames_.size()] = msg;
+			++size_;
+		}
+		else {
+			frames_[head_] = msg;
+			head_ = (head_ + 1) % frames_.size();
+		}
+		replay_.reset();
+	}
+
+	/**
+	 * @brief 按时间顺序取出全部历史,作为一个消息批交给加入者
+	 * @param
+	 * @return chat_message_batch_ptr 历史为空时返回nullptr
+	 */
+	chat_message_batch_ptr replay() {
+		if (!replay_ && size_ > 0) {
+			auto batch = std::make_shared<chat_message_batch>();
+			batch->reserve(size_);
+			for (size_t i = 0; i < size_; ++i)
+				batch->push_back(frames_[(head_ + i) % frames_.size()]);
+			replay_ = std::move(batch);
+		}
+		return replay_;
+	}
+
+	size_t size() const {
+		return size_;
+	}
+
+	size_t depth() const {
+		return frames_.size();
+	}
+
+private:
+	std::vector<chat_message_ptr> frames_;
+	//最早一条消息的位置
+	size_t head_ = 0;
+	size_t size_ = 0;
+	//上一次生成的重放批,历史变化时失效
+	chat_message_batch_ptr replay_;
+};
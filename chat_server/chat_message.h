@@ -1,22 +1,82 @@
 ﻿#pragma once
+#include <atomic>
 #include <cstdlib>
 #include <cassert>
 #include <iostream>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include "struct_header.h"
+#include "buffer_pool.h"
 
+/**
+ * @brief 变长消息帧,消息头和消息体连续存放在buffer_pool分配的内存块中,
+ *        只占用实际长度所在级别的内存,消息体上限可通过set_max_body_length配置
+ *        共享给多个接收者后不再修改,按其他编码转换的结果缓存在帧上,见transcode
+ */
 class chat_message {
 public:
 	enum { header_length = sizeof(Header) };
-	enum { max_body_length = 512 };
-	chat_message() {}
+	enum { default_max_body_length = 64 * 1024 - header_length };
+
+	chat_message() {
+		reserve(header_length);
+	}
+
+	chat_message(const chat_message &other) {
+		reserve(other.length());
+		if (other.data_) {
+			header_ = other.header_;
+			memcpy(data_, other.data_, other.length());
+		}
+	}
+
+	chat_message(chat_message &&other) noexcept
+		: header_(other.header_), data_(other.data_), capacity_(other.capacity_),
+		  transcoded_(other.transcoded_.exchange(nullptr)) {
+		other.header_ = Header{ 0, 0 };
+		other.data_ = nullptr;
+		other.capacity_ = 0;
+	}
+
+	chat_message &operator=(chat_message other) noexcept {
+		std::swap(header_, other.header_);
+		std::swap(data_, other.data_);
+		std::swap(capacity_, other.capacity_);
+		other.transcoded_ = transcoded_.exchange(other.transcoded_.load());
+		return *this;
+	}
+
+	~chat_message() {
+		buffer_pool::deallocate(data_, capacity_);
+		delete transcoded_.load();
+	}
+
+	/**
+	 * @brief 消息体长度上限,所有消息共用
+	 * @param
+	 * @return size_t
+	 */
+	static size_t max_body_length() {
+		return max_body_length_ref();
+	}
+
+	/**
+	 * @brief 设置消息体长度上限,需在收发消息之前设置
+	 * @param length 新的上限
+	 * @return
+	 */
+	static void set_max_body_length(size_t length) {
+		max_body_length_ref() = length;
+	}
 
 	const char* data() const {
 		return data_;
 	}
 
-	const int type() {
+	const int type() const {
 		return header_.type_;
 	}
 
@@ -32,21 +92,30 @@ public:
 		return data_ + header_length;
 	}
 
-	size_t body_length() {
+	size_t body_length() const {
 		return header_.body_size_;
 	}
 
 	void body_length(size_t new_length) {
-		header_.body_size_ = new_length;
-		if (header_.body_size_ > max_body_length) {
-			header_.body_size_ = max_body_length;
-		}
+		if (new_length > max_body_length())
+			new_length = max_body_length();
+		reserve(header_length + new_length);
+		header_.body_size_ = static_cast<int>(new_length);
 	}
 
 	size_t length() const {
 		return header_length + header_.body_size_;
 	}
 
+	/**
+	 * @brief 当前内存块大小
+	 * @param
+	 * @return size_t
+	 */
+	size_t capacity() const {
+		return capacity_;
+	}
+
 	/**
 	 * @brief 将本类对象的消息类型，消息体，消息头都设置好，并将数据都存入data_里
 	 * @param message_type 消息类型
@@ -55,8 +124,9 @@ public:
 	 * @return
 	 */
 	void set_message(int message_type, const void *buffer, size_t buffer_size) {
-		assert(buffer_size <= max_body_length);
-		header_.body_size_ = buffer_size;
+		assert(buffer_size <= max_body_length());
+		reserve(header_length + buffer_size);
+		header_.body_size_ = static_cast<int>(buffer_size);
 		header_.type_ = message_type;
 		memcpy(body(), buffer, buffer_size);
 		memcpy(data(), &header_, header_length);
@@ -68,21 +138,109 @@ public:
 	 * @param buffer 消息体string
 	 * @return
 	 */
-	void set_message(int message_type, std::string &buffer) {
+	void set_message(int message_type, const std::string &buffer) {
 		set_message(message_type, buffer.c_str(), buffer.size());
 	}
 
+	/**
+	 * @brief 设置消息类型和消息体长度并写好消息头,消息体由调用者直接写入body(),省去一次拷贝
+	 * @param message_type 消息类型
+	 * @param buffer_size 消息体长度
+	 * @return char* 消息体的起始地址
+	 */
+	char *prepare_message(int message_type, size_t buffer_size) {
+		assert(buffer_size <= max_body_length());
+		reserve(header_length + buffer_size);
+		header_.body_size_ = static_cast<int>(buffer_size);
+		header_.type_ = message_type;
+		memcpy(data(), &header_, header_length);
+		return body();
+	}
+
+	/**
+	 * @brief 取本帧转换成某种编码后的帧,每种编码只转换一次,结果由所有接收者共享,可在任意线程调用
+	 * @param codec 编码,CodecType
+	 * @param convert 转换函数,返回nullptr表示这种编码的客户端不接收本帧
+	 * @return std::shared_ptr<const chat_message> 转换后的帧或nullptr
+	 */
+	template <typename Convert>
+	std::shared_ptr<const chat_message> transcode(int codec, Convert &&convert) const {
+		assert(codec >= 0 && codec < codec_slots);
+		auto transcoded = transcoded_.load(std::memory_order_acquire);
+		if (!transcoded) {
+			auto created = new transcoded_frames();
+			if (transcoded_.compare_exchange_strong(transcoded, created, std::memory_order_acq_rel))
+				transcoded = created;
+			else
+				delete created;
+		}
+		auto &slot = transcoded->slots[codec];
+		std::call_once(slot.once, [&] {
+			slot.frame = convert();
+		});
+		return slot.frame;
+	}
+
+	/**
+	 * @brief 解析data_中的消息头,并确保内存块能容纳整个消息体
+	 * @param
+	 * @return bool 消息头是否合法
+	 */
 	bool decode_header() {
-		const Header *header = reinterpret_cast<const Header *>(data_);
-		header_.body_size_ = header->body_size_;
-		header_.type_ = header->type_;
-		if (header_.body_size_ > max_body_length) {
+		Header header;
+		memcpy(&header, data_, header_length);
+		if (header.body_size_ < 0 || size_t(header.body_size_) > max_body_length()) {
 			header_.body_size_ = 0;
 			return false;
 		}
+		header_ = header;
+		reserve(length());
 		return true;
 	}
+
 private:
-	Header header_;
-	char data_[header_length + max_body_length] = { 0 };
+	/**
+	 * @brief 确保内存块至少size字节,扩容时保留消息头
+	 * @param size 需要的字节数
+	 * @return
+	 */
+	void reserve(size_t size) {
+		if (size <= capacity_)
+			return;
+		size_t capacity = 0;
+		char *data = buffer_pool::allocate(size, capacity);
+		if (data_) {
+			memcpy(data, data_, header_length);
+			buffer_pool::deallocate(data_, capacity_);
+		}
+		else {
+			memset(data, 0, header_length);
+		}
+		data_ = data;
+		capacity_ = capacity;
+	}
+
+	static size_t &max_body_length_ref() {
+		static size_t length = default_max_body_length;
+		return length;
+	}
+
+private:
+	enum { codec_slots = CODEC_FLAT + 1 };
+
+	/**
+	 * @brief 各编码的转换结果,第一个需要转换的接收者分配
+	 */
+	struct transcoded_frames {
+		struct slot {
+			std::once_flag once;
+			std::shared_ptr<const chat_message> frame;
+		};
+		slot slots[codec_slots];
+	};
+
+	Header header_ = { 0, 0 };
+	char *data_ = nullptr;
+	size_t capacity_ = 0;
+	mutable std::atomic<transcoded_frames *> transcoded_{ nullptr };
 };
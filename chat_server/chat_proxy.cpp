@@ -0,0 +1,825 @@
+﻿#include "chat_proxy.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "chat_message.h"
+#include "protobuf_codec.h"
+#include "receive_buffer.h"
+#include "server_stats.h"
+
+using boost::asio::ip::tcp;
+
+/**
+ * @brief 一个方向上待发送的字节,按整帧追加,同一时间只有一个async_write,
+ *        写的过程中追加到pending,写完后与writing交换,拼接只有追加时的一次拷贝
+ */
+struct splice_buffer {
+	std::vector<char> pending;
+	std::vector<char> writing;
+
+	void append(const char *data, size_t length) {
+		pending.insert(pending.end(), data, data + length);
+	}
+
+	size_t size() const {
+		return pending.size() + writing.size();
+	}
+};
+
+/**
+ * @brief 代理的一个客户端连接,以及它对各个后端的上游连接
+ *        房间表记录每个已加入的房间在哪个后端加入,用于转发、离开和重新分配
+ */
+class proxy_session : public std::enable_shared_from_this<proxy_session> {
+public:
+	proxy_session(chat_proxy &proxy, boost::asio::io_service &io_service, tcp::socket socket)
+		: proxy_(proxy), io_service_(io_service), socket_(std::move(socket)), rejoin_timer_(io_service) {
+		boost::system::error_code ec;
+		socket_.set_option(tcp::no_delay(true), ec);
+	}
+
+	boost::asio::io_service &io_service() {
+		return io_service_;
+	}
+
+	/**
+	 * @brief 在大厅的所属后端上加入大厅,并开始读取客户端
+	 * @param
+	 * @return
+	 */
+	void start() {
+		ring_ = proxy_.ring();
+		//大厅只在所属的后端上加入: 后端默认自动加入大厅,所属后端上重复的加入会被忽略,
+		//其他后端在建立上游连接时离开大厅,关闭了自动加入的后端由这里加入
+		rooms_[lobby_room_id];
+		place_rooms();
+		read_client();
+	}
+
+	/**
+	 * @brief 哈希环变化,把所有者变化的房间从旧后端离开、在新后端加入,在本连接的线程中调用
+	 * @param ring 新的哈希环
+	 * @return
+	 */
+	void rebalance(const hash_ring_ptr &ring) {
+		if (closed_)
+			return;
+		ring_ = ring;
+		place_rooms();
+	}
+
+private:
+	enum : uint64_t { lobby_room_id = 0 };
+
+	/**
+	 * @brief 一条到后端的上游连接
+	 */
+	struct upstream {
+		upstream(boost::asio::io_service &io_service, const std::string &backend)
+			: backend(backend), socket(io_service) {
+		}
+
+		std::string backend;
+		tcp::socket socket;
+		receive_buffer read_buffer;
+		splice_buffer out;
+		bool connected = false;
+		bool closed = false;
+		bool read_paused = false;
+	};
+
+	using upstream_ptr = std::shared_ptr<upstream>;
+
+	//上游连接关闭的原因
+	enum close_reason {
+		//不再承载任何房间,或客户端连接已结束
+		upstream_idle,
+		//已建立的连接出错或被后端关闭,可能只是后端断开了这一个慢客户端,不影响其他连接
+		upstream_lost,
+		//连接不上,后端故障
+		upstream_unreachable,
+	};
+
+	/**
+	 * @brief 把房间表中所有者变化或尚未放置的房间放到当前的所有者上
+	 * @param
+	 * @return
+	 */
+	void place_rooms() {
+		size_t moved = 0;
+		for (auto &room : rooms_) {
+			auto owner = ring_->owner(room.first);
+			if (!owner || owner->name == room.second)
+				continue;
+			if (!room.second.empty()) {
+				auto old = upstreams_.find(room.second);
+				if (old != upstreams_.end())
+					send(old->second, MT_LEAVE_ROOM, room_body<PLeaveRoom>(room.first));
+				++moved;
+			}
+			room.second = owner->name;
+			send(upstream_for(*owner), MT_JOIN_ROOM, join_body(room.first, owner->name));
+		}
+		if (moved > 0)
+			server_stats::instance().record_proxy_moves(moved);
+
+		//不再承载任何房间的上游连接可以关闭
+		std::vector<upstream_ptr> idle;
+		for (const auto &u : upstreams_) {
+			bool used = false;
+			for (const auto &room : rooms_)
+				used = used || room.second == u.first;
+			if (!used)
+				idle.push_back(u.second);
+		}
+		for (const auto &u : idle)
+			close_upstream(u, upstream_idle);
+	}
+
+	/**
+	 * @brief 在后端上加入房间的消息体,重新加入之前转发过的后端时带上最后转发的序号,只补发缺口
+	 * @param room_id 房间id
+	 * @param backend 加入的后端
+	 * @return std::string
+	 */
+	std::string join_body(uint64_t room_id, const std::string &backend) const {
+		PJoinRoom join;
+		join.set_room_id(room_id);
+		//序号只在同一个后端内有意义,换到其他后端时重放全部历史
+		auto seen = last_seen_.find(room_id);
+		if (seen != last_seen_.end() && seen->second.backend == backend)
+			join.set_last_seq(seen->second.seq);
+		return join.SerializeAsString();
+	}
+
+	/**
+	 * @brief 上游连接发来的一帧是否要转发给客户端,房间消息只接受房间当前所在的后端发来的,
+	 *        并按序号去重: 重新加入同一个后端时,自动加入大厅等重放的已转发过的消息被丢弃
+	 * @param u 上游连接
+	 * @param type 消息类型
+	 * @param body 消息体
+	 * @param body_length 消息体长度
+	 * @return bool
+	 */
+	bool accept_upstream_frame(const upstream_ptr &u, int type, const char *body, size_t body_length) {
+		if (type != MT_ROOM_INFO)
+			return true;
+		uint64_t room_id, seq;
+		if (!scan_room_info(body, body_length, room_id, seq))
+			return true;
+		//离开前已在路上的消息、非所有者后端自动加入大厅后重放的历史,序号与所有者的不连续
+		auto room = rooms_.find(room_id);
+		if (room == rooms_.end() || room->second != u->backend)
+			return false;
+		if (seq == 0)
+			return true;
+		auto &seen = last_seen_[room_id];
+		if (seen.backend == u->backend && seq <= seen.seq)
+			return false;
+		seen.backend = u->backend;
+		seen.seq = seq;
+		return true;
+	}
+
+	template <typename Message>
+	static std::string room_body(uint64_t room_id) {
+		Message message;
+		message.set_room_id(room_id);
+		return message.SerializeAsString();
+	}
+
+	/**
+	 * @brief 取到后端的上游连接,没有时创建并先补发绑定的名字,
+	 *        大厅不在该后端上时离开后端自动加入的大厅
+	 * @param node 后端
+	 * @return upstream_ptr
+	 */
+	upstream_ptr upstream_for(const hash_ring::node &node) {
+		auto &u = upstreams_[node.name];
+		if (u)
+			return u;
+		u = std::make_shared<upstream>(io_service(), node.name);
+		if (!bind_frame_.empty())
+			u->out.append(bind_frame_.data(), bind_frame_.size());
+		auto lobby = rooms_.find(lobby_room_id);
+		if (lobby == rooms_.end() || lobby->second != node.name) {
+			chat_message leave;
+			leave.set_message(MT_LEAVE_ROOM, room_body<PLeaveRoom>(lobby_room_id));
+			u->out.append(leave.data(), leave.length());
+		}
+		auto self(shared_from_this());
+		auto up = u;
+		up->socket.async_connect(node.endpoint, [this, self, up](boost::system::error_code ec) {
+			if (up->closed)
+				return;
+			if (ec) {
+				close_upstream(up, upstream_unreachable);
+				return;
+			}
+			boost::system::error_code ignored;
+			up->socket.set_option(tcp::no_delay(true), ignored);
+			up->connected = true;
+			write_upstream(up);
+			read_upstream(up);
+		});
+		return u;
+	}
+
+	/**
+	 * @brief 编码一帧发给上游连接
+	 * @param u 上游连接
+	 * @param type 消息类型
+	 * @param body 消息体
+	 * @return
+	 */
+	void send(const upstream_ptr &u, int type, const std::string &body) {
+		chat_message msg;
+		msg.set_message(type, body);
+		u->out.append(msg.data(), msg.length());
+		write_upstream(u);
+	}
+
+	/**
+	 * @brief 按房间转发客户端的一帧
+	 * @param room_id 房间id
+	 * @param frame 整帧
+	 * @param length 帧长度
+	 * @return
+	 */
+	void forward(uint64_t room_id, const char *frame, size_t length) {
+		//已加入的房间发往加入时的后端,未加入的发往当前的所有者,由后端按成员资格丢弃
+		auto room = rooms_.find(room_id);
+		const hash_ring::node *owner = nullptr;
+		//上游连接断开后尚未重新放置的房间,先在所有者上重新加入
+		if (room != rooms_.end() && room->second.empty())
+			place_rooms();
+		if (room != rooms_.end() && !room->second.empty()) {
+			auto u = upstreams_.find(room->second);
+			if (u != upstreams_.end()) {
+				u->second->out.append(frame, length);
+				write_upstream(u->second);
+				return;
+			}
+		}
+		owner = ring_->owner(room_id);
+		if (!owner)
+			return;
+		auto u = upstream_for(*owner);
+		u->out.append(frame, length);
+		write_upstream(u);
+	}
+
+	/**
+	 * @brief 处理客户端的一帧,只解析需要路由的房间id
+	 * @param type 消息类型
+	 * @param frame 整帧
+	 * @param length 帧长度
+	 * @return
+	 */
+	void on_client_frame(int type, const char *frame, size_t length) {
+		const char *body = frame + chat_message::header_length;
+		int body_length = int(length - chat_message::header_length);
+		if (type == MT_BIND_NAME) {
+			//名字要在每个后端上绑定,新建的上游连接也先补发
+			bind_frame_.assign(frame, length);
+			for (const auto &u : upstreams_) {
+				u.second->out.append(frame, length);
+				write_upstream(u.second);
+			}
+		}
+		else if (type == MT_JOIN_ROOM) {
+			PJoinRoom join;
+			if (!join.ParseFromArray(body, body_length))
+				return;
+			auto owner = ring_->owner(join.room_id());
+			if (!owner)
+				return;
+			auto &room = rooms_[join.room_id()];
+			if (!room.empty() && room != owner->name)
+				return;
+			room = owner->name;
+			auto u = upstream_for(*owner);
+			u->out.append(frame, length);
+			write_upstream(u);
+		}
+		else if (type == MT_LEAVE_ROOM) {
+			PLeaveRoom leave;
+			if (!leave.ParseFromArray(body, body_length))
+				return;
+			forward(leave.room_id(), frame, length);
+			if (leave.room_id() != lobby_room_id) {
+				rooms_.erase(leave.room_id());
+				last_seen_.erase(leave.room_id());
+			}
+		}
+		else if (type == MT_ROOM_CHAT) {
+			PRoomChat chat;
+			if (chat.ParseFromArray(body, body_length))
+				forward(chat.room_id(), frame, length);
+		}
+		else if (type == MT_CHAT_INFO || type == MT_DIRECT_CHAT) {
+			//每个客户端都在大厅的所属后端上绑定了名字,私聊也发往那里
+			forward(lobby_room_id, frame, length);
+		}
+		else if (type == MT_CODEC_HELLO) {
+			//代理只原样转发protobuf帧,直接回复protobuf,不转给后端
+			char codec = char(CODEC_PROTOBUF);
+			chat_message select;
+			select.set_message(MT_CODEC_SELECT, &codec, 1);
+			out_.append(select.data(), select.length());
+			write_client();
+		}
+	}
+
+	void read_client() {
+		auto self(shared_from_this());
+		socket_.async_read_some(
+			boost::asio::buffer(read_buffer_.write_data(), read_buffer_.write_size()),
+			[this, self](boost::system::error_code ec, size_t length) {
+				if (ec || closed_) {
+					close();
+					return;
+				}
+				read_buffer_.commit(length);
+				auto frames = parse_frames(read_buffer_, [this](int type, const char *body, size_t body_length) {
+					on_client_frame(type, body - chat_message::header_length, chat_message::header_length + body_length);
+				});
+				if (frames < 0) {
+					close();
+					return;
+				}
+				server_stats::instance().record_read(frames);
+				//任一后端积压过多时暂停读取客户端,该后端发送完后恢复
+				if (upstream_backlogged())
+					read_paused_ = true;
+				else
+					read_client();
+			});
+	}
+
+	bool upstream_backlogged() const {
+		for (const auto &u : upstreams_) {
+			if (u.second->out.size() > proxy_.options().high_water_bytes)
+				return true;
+		}
+		return false;
+	}
+
+	void write_client() {
+		if (closed_ || !out_.writing.empty() || out_.pending.empty())
+			return;
+		out_.writing.swap(out_.pending);
+		auto self(shared_from_this());
+		boost::asio::async_write(socket_, boost::asio::buffer(out_.writing),
+			[this, self](boost::system::error_code ec, size_t length) {
+				if (ec) {
+					close();
+					return;
+				}
+				server_stats::instance().record_flush(1, length);
+				out_.writing.clear();
+				write_client();
+				if (out_.size() > proxy_.options().high_water_bytes)
+					return;
+				for (const auto &u : upstreams_) {
+					if (u.second->read_paused) {
+						u.second->read_paused = false;
+						read_upstream(u.second);
+					}
+				}
+			});
+	}
+
+	void read_upstream(const upstream_ptr &u) {
+		auto self(shared_from_this());
+		u->socket.async_read_some(
+			boost::asio::buffer(u->read_buffer.write_data(), u->read_buffer.write_size()),
+			[this, self, u](boost::system::error_code ec, size_t length) {
+				if (u->closed)
+					return;
+				if (ec) {
+					close_upstream(u, upstream_lost);
+					return;
+				}
+				u->read_buffer.commit(length);
+				//按帧边界拼接,不同后端的帧不会交错
+				auto frames = parse_frames(u->read_buffer, [this, &u](int type, const char *body, size_t body_length) {
+					if (accept_upstream_frame(u, type, body, body_length))
+						out_.append(body - chat_message::header_length, chat_message::header_length + body_length);
+				});
+				if (frames < 0) {
+					close_upstream(u, upstream_lost);
+					return;
+				}
+				write_client();
+				if (out_.size() > proxy_.options().high_water_bytes)
+					u->read_paused = true;
+				else
+					read_upstream(u);
+			});
+	}
+
+	void write_upstream(const upstream_ptr &u) {
+		if (u->closed || !u->connected || !u->out.writing.empty() || u->out.pending.empty())
+			return;
+		u->out.writing.swap(u->out.pending);
+		auto self(shared_from_this());
+		boost::asio::async_write(u->socket, boost::asio::buffer(u->out.writing),
+			[this, self, u](boost::system::error_code ec, size_t) {
+				if (u->closed)
+					return;
+				if (ec) {
+					close_upstream(u, upstream_lost);
+					return;
+				}
+				u->out.writing.clear();
+				write_upstream(u);
+				resume_client();
+			});
+	}
+
+	/**
+	 * @brief 后端的积压消除后恢复读取客户端
+	 * @param
+	 * @return
+	 */
+	void resume_client() {
+		if (read_paused_ && !closed_ && !upstream_backlogged()) {
+			read_paused_ = false;
+			read_client();
+		}
+	}
+
+	/**
+	 * @brief 关闭一条上游连接,只有连接不上时才报告后端故障,已建立的连接断开只影响本连接
+	 *        其上的房间在房间表中标记为未放置: 连接断开时稍后在所有者上重新加入,
+	 *        连接不上时等新的哈希环发布后重新放置
+	 * @param u 上游连接
+	 * @param reason 关闭的原因
+	 * @return
+	 */
+	void close_upstream(const upstream_ptr &u, close_reason reason) {
+		if (u->closed)
+			return;
+		u->closed = true;
+		boost::system::error_code ec;
+		u->socket.close(ec);
+		auto it = upstreams_.find(u->backend);
+		if (it != upstreams_.end() && it->second == u)
+			upstreams_.erase(it);
+		if (reason != upstream_idle && !closed_) {
+			//后端上的成员资格随连接一起失去,新的上游连接要重新加入
+			for (auto &room : rooms_) {
+				if (room.second == u->backend)
+					room.second.clear();
+			}
+			if (reason == upstream_unreachable)
+				proxy_.report_failure(u->backend);
+			else
+				schedule_rejoin();
+		}
+		resume_client();
+	}
+
+	/**
+	 * @brief 上游连接断开后稍等再重新加入,客户端的积压降到高水位以下才加入,
+	 *        避免后端因客户端太慢断开时反复重连;重新加入时带上最后转发的序号,等待期间的消息会补发
+	 * @param
+	 * @return
+	 */
+	void schedule_rejoin() {
+		if (rejoin_pending_)
+			return;
+		rejoin_pending_ = true;
+		rejoin_timer_.expires_from_now(std::chrono::milliseconds(proxy_.options().check_interval_ms));
+		auto self(shared_from_this());
+		rejoin_timer_.async_wait([this, self](boost::system::error_code ec) {
+			rejoin_pending_ = false;
+			if (ec || closed_)
+				return;
+			if (out_.size() > proxy_.options().high_water_bytes) {
+				schedule_rejoin();
+				return;
+			}
+			place_rooms();
+		});
+	}
+
+	void close() {
+		if (closed_)
+			return;
+		closed_ = true;
+		boost::system::error_code ec;
+		socket_.close(ec);
+		rejoin_timer_.cancel(ec);
+		auto upstreams = upstreams_;
+		for (const auto &u : upstreams)
+			close_upstream(u.second, upstream_idle);
+		proxy_.remove_session(this);
+	}
+
+private:
+	chat_proxy &proxy_;
+	boost::asio::io_service &io_service_;
+	tcp::socket socket_;
+	receive_buffer read_buffer_;
+	splice_buffer out_;
+	bool closed_ = false;
+	bool read_paused_ = false;
+	//上游连接断开后重新加入房间的定时器
+	boost::asio::steady_timer rejoin_timer_;
+	bool rejoin_pending_ = false;
+	hash_ring_ptr ring_;
+	//按后端地址索引的上游连接
+	std::map<std::string, upstream_ptr> upstreams_;
+	//已加入的房间及其加入时的后端,空表示还没有可用的后端或所在的上游连接已断开
+	std::map<uint64_t, std::string> rooms_;
+	//最近一次绑定名字的整帧
+	std::string bind_frame_;
+
+	/**
+	 * @brief 一个房间最后转发给客户端的消息来自哪个后端、序号是多少
+	 */
+	struct room_cursor {
+		std::string backend;
+		uint64_t seq = 0;
+	};
+	std::map<uint64_t, room_cursor> last_seen_;
+};
+
+/**
+ * @brief 构造
+ * @param services 客户端连接所在的io_service,轮流分配,services[0]还运行监听和后端检查
+ * @param port 监听端口
+ * @param options 代理参数
+ * @return 本类对象
+ */
+chat_proxy::chat_proxy(const std::vector<boost::asio::io_service *> &services, int port, const proxy_options &options)
+	: services_(services), options_(options),
+	  acceptor_(*services[0], tcp::endpoint(tcp::v4(), port)), strand_(*services[0]), check_timer_(*services[0]),
+	  ring_(std::make_shared<hash_ring>(std::vector<hash_ring::node>(), options.virtual_nodes)) {
+}
+
+chat_proxy::~chat_proxy() {
+}
+
+/**
+ * @brief 解析后端、发布哈希环并开始接受客户端
+ * @param
+ * @return
+ */
+void chat_proxy::start() {
+	strand_.dispatch([this] {
+		update_backends(options_.backends);
+		reload_backends_file();
+		//全部后端解析完再发布,避免启动时逐个加入引起的重新分配
+		if (!resolving())
+			publish();
+		schedule_check();
+	});
+	do_accept();
+}
+
+/**
+ * @brief 当前发布的哈希环,可在任意线程调用
+ * @param
+ * @return hash_ring_ptr
+ */
+hash_ring_ptr chat_proxy::ring() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return ring_;
+}
+
+/**
+ * @brief 上游连接连不上后端,把该后端移出哈希环,之后定期探测,恢复后再加入,可在任意线程调用
+ * @param backend 后端地址
+ * @return
+ */
+void chat_proxy::report_failure(const std::string &backend) {
+	strand_.post([this, backend] {
+		auto it = backends_.find(backend);
+		if (it == backends_.end() || !it->second.up)
+			return;
+		it->second.up = false;
+		std::cerr << "proxy: backend " << backend << " is down" << std::endl;
+		publish();
+	});
+}
+
+/**
+ * @brief 连接结束,不再接收重新分配的通知,可在任意线程调用
+ * @param session 连接
+ * @return
+ */
+void chat_proxy::remove_session(proxy_session *session) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	sessions_.erase(session);
+}
+
+void chat_proxy::do_accept() {
+	//连接轮流分配到各个io_service,之后它的所有上游连接都在同一个线程中
+	auto &service = *services_[next_service_++ % services_.size()];
+	auto socket = std::make_shared<tcp::socket>(service);
+	acceptor_.async_accept(*socket, [this, &service, socket](boost::system::error_code ec) {
+		if (!ec) {
+			server_stats::instance().record_accept();
+			auto session = std::make_shared<proxy_session>(*this, service, std::move(*socket));
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				sessions_[session.get()] = session;
+			}
+			session->io_service().post([session] {
+				session->start();
+			});
+		}
+		do_accept();
+	});
+}
+
+/**
+ * @brief 定期重新读取后端列表文件并探测故障的后端
+ * @param
+ * @return
+ */
+void chat_proxy::schedule_check() {
+	check_timer_.expires_from_now(std::chrono::milliseconds(options_.check_interval_ms));
+	check_timer_.async_wait(strand_.wrap([this](boost::system::error_code ec) {
+		if (ec)
+			return;
+		if (reload_backends_file())
+			publish();
+		for (const auto &backend : backends_) {
+			if (backend.second.up || backend.second.probing)
+				continue;
+			if (backend.second.resolved)
+				probe(backend.first);
+			else
+				resolve(backend.first);
+		}
+		schedule_check();
+	}));
+}
+
+/**
+ * @brief 后端列表文件的内容变化时按文件更新backends_
+ * @param
+ * @return bool 后端集合是否变化
+ */
+bool chat_proxy::reload_backends_file() {
+	if (options_.backends_file.empty())
+		return false;
+	std::ifstream in(options_.backends_file);
+	if (!in)
+		return false;
+	std::stringstream contents;
+	contents << in.rdbuf();
+	if (contents.str() == backends_file_contents_)
+		return false;
+	backends_file_contents_ = contents.str();
+	std::vector<std::string> names;
+	std::string line;
+	while (std::getline(contents, line)) {
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (!line.empty() && line[0] != '#')
+			names.push_back(line);
+	}
+	return update_backends(names);
+}
+
+/**
+ * @brief 用后端列表更新backends_,新的后端异步解析地址,解析完成前不在哈希环中
+ * @param names 后端地址
+ * @return bool 后端集合是否变化
+ */
+bool chat_proxy::update_backends(const std::vector<std::string> &names) {
+	std::map<std::string, backend_state> backends;
+	std::vector<std::string> added;
+	for (const auto &name : names) {
+		auto it = backends_.find(name);
+		if (it != backends_.end()) {
+			backends.insert(*it);
+			continue;
+		}
+		if (name.rfind(':') == std::string::npos) {
+			std::cerr << "proxy: bad backend address " << name << std::endl;
+			continue;
+		}
+		backends[name];
+		added.push_back(name);
+	}
+	bool changed = backends.size() != backends_.size() ||
+				   !std::equal(backends.begin(), backends.end(), backends_.begin(),
+							   [](const std::pair<const std::string, backend_state> &a,
+								  const std::pair<const std::string, backend_state> &b) {
+		return a.first == b.first;
+	});
+	backends_.swap(backends);
+	for (const auto &name : added)
+		resolve(name);
+	return changed;
+}
+
+/**
+ * @brief 异步解析一个新后端的地址,成功后加入哈希环,失败时等下次检查再试
+ *        解析在services_[0]上进行,不阻塞同一线程中的客户端连接
+ * @param name 后端地址
+ * @return
+ */
+void chat_proxy::resolve(const std::string &name) {
+	backends_[name].probing = true;
+	auto colon = name.rfind(':');
+	auto resolver = std::make_shared<tcp::resolver>(*services_[0]);
+	resolver->async_resolve(tcp::resolver::query(name.substr(0, colon), name.substr(colon + 1)),
+		strand_.wrap([this, name, resolver](boost::system::error_code ec, tcp::resolver::iterator endpoints) {
+			auto it = backends_.find(name);
+			if (it == backends_.end())
+				return;
+			it->second.probing = false;
+			if (ec || endpoints == tcp::resolver::iterator()) {
+				if (it->second.resolve_failed)
+					return;
+				it->second.resolve_failed = true;
+				std::cerr << "proxy: cannot resolve backend " << name << ": " << ec.message() << std::endl;
+				//启动时等待的后端有一个解析失败,其余的不再等它
+				if (!resolving())
+					publish();
+				return;
+			}
+			it->second.endpoint = endpoints->endpoint();
+			it->second.resolved = true;
+			it->second.up = true;
+			if (!resolving())
+				publish();
+		}));
+}
+
+/**
+ * @brief 是否还有后端在解析地址
+ * @param
+ * @return bool
+ */
+bool chat_proxy::resolving() const {
+	for (const auto &backend : backends_) {
+		if (!backend.second.resolved && backend.second.probing)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * @brief 试连一个故障的后端,成功后加回哈希环
+ * @param name 后端地址
+ * @return
+ */
+void chat_proxy::probe(const std::string &name) {
+	auto &backend = backends_[name];
+	backend.probing = true;
+	auto socket = std::make_shared<tcp::socket>(*services_[0]);
+	socket->async_connect(backend.endpoint, strand_.wrap([this, name, socket](boost::system::error_code ec) {
+		boost::system::error_code ignored;
+		socket->close(ignored);
+		auto it = backends_.find(name);
+		if (it == backends_.end())
+			return;
+		it->second.probing = false;
+		if (ec)
+			return;
+		it->second.up = true;
+		std::cerr << "proxy: backend " << name << " is back" << std::endl;
+		publish();
+	}));
+}
+
+/**
+ * @brief 用正常的后端构造新的哈希环并发布,通知所有连接重新分配房间,只在strand_中调用
+ * @param
+ * @return
+ */
+void chat_proxy::publish() {
+	std::vector<hash_ring::node> nodes;
+	for (const auto &backend : backends_) {
+		if (backend.second.up)
+			nodes.push_back(hash_ring::node{ backend.first, backend.second.endpoint });
+	}
+	std::cout << "proxy: " << nodes.size() << " of " << backends_.size() << " backends in the ring" << std::endl;
+	auto ring = std::make_shared<const hash_ring>(std::move(nodes), options_.virtual_nodes);
+
+	std::vector<std::shared_ptr<proxy_session>> sessions;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		ring_ = ring;
+		sessions.reserve(sessions_.size());
+		for (const auto &s : sessions_) {
+			auto session = s.second.lock();
+			if (session)
+				sessions.push_back(std::move(session));
+		}
+	}
+	server_stats::instance().record_proxy_rebalance();
+	for (const auto &session : sessions) {
+		session->io_service().post([session, ring] {
+			session->rebalance(ring);
+		});
+	}
+}
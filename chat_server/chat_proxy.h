@@ -0,0 +1,169 @@
+﻿#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio.hpp>
+#include "hash_ring.h"
+
+/**
+ * @brief 前端代理参数
+ */
+struct proxy_options {
+	//后端chat_server的地址"host:port",非空时以代理模式运行
+	std::vector<std::string> backends;
+	//后端列表文件,每行一个"host:port",定期重新读取,增删后端时重新分配房间
+	std::string backends_file;
+	//每个后端在哈希环上的虚拟节点数
+	int virtual_nodes = 160;
+	//检查后端列表文件和探测故障后端的间隔(毫秒)
+	int check_interval_ms = 1000;
+	//一个方向上积压的字节数超过该值时暂停读取对端,发送完后恢复
+	size_t high_water_bytes = 1024 * 1024;
+
+	bool enabled() const {
+		return !backends.empty() || !backends_file.empty();
+	}
+};
+
+class proxy_session;
+
+/**
+ * @brief 按房间水平扩展的前端代理,使用与chat_server相同的chat_message帧
+ *        房间id经一致性哈希确定所属的后端,每个客户端连接对每个用到的后端开一条上游连接,
+ *        客户端的帧按房间转发到所属后端的上游连接,所有上游连接发来的帧原样拼接回客户端,
+ *        每帧只拷贝一次,不重新编码
+ *        后端故障、恢复或列表文件变化时发布新的哈希环,各连接把所有者变化的房间从旧后端离开、在新后端加入
+ *        每个连接及其上游连接都在同一个io_service(一个线程)中,不需要strand
+ */
+class chat_proxy {
+public:
+	/**
+	 * @brief 构造
+	 * @param services 客户端连接所在的io_service,轮流分配,services[0]还运行监听和后端检查
+	 * @param port 监听端口
+	 * @param options 代理参数
+	 * @return 本类对象
+	 */
+	chat_proxy(const std::vector<boost::asio::io_service *> &services, int port, const proxy_options &options);
+	~chat_proxy();
+
+	chat_proxy(const chat_proxy &) = delete;
+	chat_proxy &operator=(const chat_proxy &) = delete;
+
+	/**
+	 * @brief 解析后端、发布哈希环并开始接受客户端
+	 * @param
+	 * @return
+	 */
+	void start();
+
+	/**
+	 * @brief 当前发布的哈希环,可在任意线程调用
+	 * @param
+	 * @return hash_ring_ptr
+	 */
+	hash_ring_ptr ring() const;
+
+	/**
+	 * @brief 上游连接连不上后端,把该后端移出哈希环,之后定期探测,恢复后再加入,可在任意线程调用
+	 * @param backend 后端地址
+	 * @return
+	 */
+	void report_failure(const std::string &backend);
+
+	/**
+	 * @brief 连接结束,不再接收重新分配的通知,可在任意线程调用
+	 * @param session 连接
+	 * @return
+	 */
+	void remove_session(proxy_session *session);
+
+	const proxy_options &options() const {
+		return options_;
+	}
+
+private:
+	/**
+	 * @brief 一个后端的状态,只在strand_中访问
+	 */
+	struct backend_state {
+		boost::asio::ip::tcp::endpoint endpoint;
+		//地址解析成功后才加入哈希环
+		bool resolved = false;
+		//解析失败过,之后的失败不再记录
+		bool resolve_failed = false;
+		bool up = false;
+		//正在解析地址或试连
+		bool probing = false;
+	};
+
+	void do_accept();
+
+	/**
+	 * @brief 定期重新读取后端列表文件并探测故障的后端
+	 * @param
+	 * @return
+	 */
+	void schedule_check();
+
+	/**
+	 * @brief 后端列表文件的内容变化时按文件更新backends_
+	 * @param
+	 * @return bool 后端集合是否变化
+	 */
+	bool reload_backends_file();
+
+	/**
+	 * @brief 用后端列表更新backends_,新的后端先解析地址
+	 * @param names 后端地址
+	 * @return bool 后端集合是否变化
+	 */
+	bool update_backends(const std::vector<std::string> &names);
+
+	/**
+	 * @brief 异步解析一个新后端的地址,成功后加入哈希环,失败时等下次检查再试
+	 * @param name 后端地址
+	 * @return
+	 */
+	void resolve(const std::string &name);
+
+	/**
+	 * @brief 是否还有后端在解析地址
+	 * @param
+	 * @return bool
+	 */
+	bool resolving() const;
+
+	/**
+	 * @brief 试连一个故障的后端,成功后加回哈希环
+	 * @param name 后端地址
+	 * @return
+	 */
+	void probe(const std::string &name);
+
+	/**
+	 * @brief 用正常的后端构造新的哈希环并发布,通知所有连接重新分配房间,只在strand_中调用
+	 * @param
+	 * @return
+	 */
+	void publish();
+
+private:
+	std::vector<boost::asio::io_service *> services_;
+	size_t next_service_ = 0;
+	proxy_options options_;
+	boost::asio::ip::tcp::acceptor acceptor_;
+	boost::asio::io_service::strand strand_;
+	boost::asio::steady_timer check_timer_;
+	std::map<std::string, backend_state> backends_;
+	//上一次读取的后端列表文件内容
+	std::string backends_file_contents_;
+
+	mutable std::mutex mutex_;
+	hash_ring_ptr ring_;
+	std::unordered_map<proxy_session *, std::weak_ptr<proxy_session>> sessions_;
+};
@@ -0,0 +1,558 @@
+﻿#include "chat_room.h"
+#include <algorithm>
+#include "protocol.pb.h"
+#include "server_stats.h"
+
+//PRoomInformation.seq(字段4,fixed64)的tag,该字段编号最大,编码后是消息体的最后9个字节
+enum { seq_field_tag = (4 << 3) | 1, seq_field_length = 9 };
+
+/**
+ * @brief 取消息体末尾seq字段的8字节值所在位置
+ * @param msg 消息帧
+ * @return const char* 不是带seq字段的房间消息时返回nullptr
+ */
+static const char *seq_field_of(const chat_message &msg) {
+	if (msg.type() != MT_ROOM_INFO || msg.body_length() < seq_field_length)
+		return nullptr;
+	const char *field = msg.body() + msg.body_length() - seq_field_length;
+	return static_cast<unsigned char>(field[0]) == seq_field_tag ? field + 1 : nullptr;
+}
+
+/**
+ * @brief 读取消息帧中的房间序号
+ * @param msg 消息帧
+ * @return uint64_t 没有序号时返回0
+ */
+static uint64_t room_seq_of(const chat_message &msg) {
+	auto field = seq_field_of(msg);
+	if (!field)
+		return 0;
+	uint64_t seq = 0;
+	for (int i = 7; i >= 0; --i)
+		seq = (seq << 8) | static_cast<unsigned char>(field[i]);
+	return seq;
+}
+
+/**
+ * @brief 把占位的序号原地改写为实际序号,fixed64是小端定长编码,消息体长度不变
+ * @param msg 消息帧
+ * @param seq 序号
+ * @return bool 消息帧中是否有占位的序号
+ */
+static bool stamp_room_seq(chat_message &msg, uint64_t seq) {
+	if (room_seq_of(msg) != chat_room::unstamped_seq)
+		return false;
+	char *field = msg.body() + msg.body_length() - seq_field_length + 1;
+	for (int i = 0; i < 8; ++i)
+		field[i] = char((seq >> (8 * i)) & 0xff);
+	return true;
+}
+
+/**
+ * @brief 构造
+ * @param io_service 房间定时器和快照重建所在的io_service
+ * @param strand 房间所在分片的strand
+ * @param room_id 房间id
+ * @param options 房间参数
+ * @param fanout_services 分区strand所在的io_service
+ * @return 本类对象
+ */
+chat_room::chat_room(boost::asio::io_service &io_service, boost::asio::io_service::strand &strand,
+					 uint64_t room_id, const room_options &options,
+					 const std::vector<boost::asio::io_service *> &fanout_services)
+	: io_service_(io_service), strand_(strand), history_(size_t(options.history_depth)), log_timer_(io_service),
+	  partition_members_(1), timer_(io_service),
+	  options_(options), join_timer_(io_service), room_id_(room_id), fanout_services_(fanout_services) {
+	auto snapshot = std::make_shared<member_snapshot>();
+	snapshot->partitions.push_back(std::make_shared<member_snapshot::member_list>());
+	snapshot_ = std::move(snapshot);
+	//日志打开失败时退回到只在内存中保留历史
+	if (!options.log.dir.empty())
+		log_ = room_log::open(options.log, room_id);
+
+	//内存中的历史随房间回收而丢失,序号从创建时间开始编号,同一房间id前后两个实例的序号不会重叠,
+	//客户端带着旧实例的序号重连时会收到MT_RESYNC_TOO_FAR而不是错误的缺口
+	auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+	next_seq_ = uint64_t(now_ms) << 20;
+	if (log_ && log_->next_seq() > log_->first_seq()) {
+		auto last = log_->read(log_->next_seq() - 1, log_->next_seq());
+		if (last)
+			next_seq_ = std::max(next_seq_, room_seq_of(*last->front()) + 1);
+	}
+}
+
+/**
+ * @brief 客户端加入事件
+ * @param cp 客户端智能指针
+ * @return
+ */
+void chat_room::join(const chat_participant_ptr &cp, uint64_t last_seq) {
+	if (options_.join_batch <= 0) {
+		change_membership(cp, true, last_seq);
+		return;
+	}
+	if (joining_.find(cp.get()))
+		return;
+	//进入准入队列,接纳前不接收广播,接纳时重放的历史已包含排队期间的消息
+	server_stats::instance().record_deferred_join();
+	join_queue_.push_back(joining_.insert(cp, last_seq).first);
+	if (!join_timer_armed_)
+		admit_pending();
+}
+
+/**
+ * @brief 客户端离开事件,在下一个快照发布后不再收到广播
+ * @param cp 客户端智能指针
+ * @return
+ */
+void chat_room::leave(const chat_participant_ptr &cp) {
+	joining_.erase(cp.get());
+	change_membership(cp, false);
+}
+
+/**
+ * @brief 给所有客户端分发消息,开启攒批且负载较高时先攒到当前批中,
+ *        窗口到期或达到batch_max_msgs条时再一起广播
+ * @param msg 编码好的消息帧,序号为unstamped_seq
+ * @return
+ */
+void chat_room::deliver(const std::shared_ptr<chat_message> &msg) {
+	//序号按进入房间的顺序分配,攒批和分区都不改变这个顺序
+	if (stamp_room_seq(*msg, next_seq_))
+		++next_seq_;
+
+	if (options_.batch_window_us <= 0) {
+		deliver_now(msg);
+		return;
+	}
+
+	bool busy = update_load();
+	if (pending_.empty() && !busy) {
+		deliver_now(msg);
+		return;
+	}
+
+	pending_.push_back(msg);
+	if (pending_.size() >= size_t(options_.batch_max_msgs)) {
+		flush_batch();
+		return;
+	}
+	if (!timer_armed_) {
+		//窗口随负载变化:预计攒满一批所需的时间,但不超过batch_window_us
+		auto window = std::min(double(options_.batch_window_us),
+							   avg_interval_us_ * options_.batch_max_msgs);
+		timer_armed_ = true;
+		timer_.expires_from_now(std::chrono::microseconds(int64_t(window)));
+		//房间可能在定时器到期前被回收,回调持有房间的引用
+		auto self(shared_from_this());
+		auto generation = batch_generation_;
+		timer_.async_wait(strand_.wrap([this, self, generation](boost::system::error_code ec) {
+			if (!ec && generation == batch_generation_)
+				flush_batch();
+		}));
+	}
+}
+
+/**
+ * @brief 立即把一条消息广播给所有客户端,只在strand_中调用
+ * @param msg 编码好的共享消息帧
+ * @return
+ */
+void chat_room::deliver_now(const chat_message_ptr &msg) {
+	remember(msg);
+	fan_out(msg);
+}
+
+/**
+ * @brief 把攒下的消息作为一批广播给所有客户端,只在strand_中调用
+ * @param
+ * @return
+ */
+void chat_room::flush_batch() {
+	++batch_generation_;
+	if (timer_armed_) {
+		timer_armed_ = false;
+		timer_.cancel();
+	}
+	if (pending_.empty())
+		return;
+
+	auto batch = std::make_shared<chat_message_batch>();
+	batch->swap(pending_);
+	for (const auto &msg : *batch)
+		remember(msg);
+	server_stats::instance().record_batch(batch->size());
+
+	chat_message_batch_ptr shared_batch(std::move(batch));
+	fan_out(shared_batch);
+}
+
+/**
+ * @brief 更新消息到达间隔的滑动平均,并据此判断是否需要攒批
+ * @param
+ * @return bool 当前负载下一个窗口内是否预计有多条消息
+ */
+bool chat_room::update_load() {
+	auto now = std::chrono::steady_clock::now();
+	double interval = std::chrono::duration<double, std::micro>(now - last_arrival_).count();
+	last_arrival_ = now;
+	//间隔截断到两个窗口,空闲很久后几条连续消息就能让平均值收敛
+	double idle = 2.0 * options_.batch_window_us;
+	avg_interval_us_ = std::min(avg_interval_us_, idle);
+	avg_interval_us_ += (std::min(interval, idle) - avg_interval_us_) / 8;
+	return avg_interval_us_ * 2 < options_.batch_window_us;
+}
+
+/**
+ * @brief 记下一次成员变更,没有进行中的重建时发起重建,只在strand_中调用
+ * @param cp 客户端智能指针
+ * @param join 加入还是离开
+ * @param last_seq 加入时客户端最后收到的序号
+ * @return
+ */
+void chat_room::change_membership(const chat_participant_ptr &cp, bool join, uint64_t last_seq) {
+	changes_.push_back(membership_change{ cp, join, last_seq });
+	if (!rebuilding_)
+		start_rebuild();
+}
+
+/**
+ * @brief 把积攒的变更交给一次重建,只在strand_中调用
+ * @param
+ * @return
+ */
+void chat_room::start_rebuild() {
+	rebuilding_ = true;
+	std::vector<membership_change> changes;
+	changes.swap(changes_);
+	//重建不占用分片的strand,期间同一分片的广播和其他房间照常进行
+	auto self(shared_from_this());
+	io_service_.post([this, self, changes, current = snapshot_] {
+		auto result = std::make_shared<rebuild_result>(rebuild(changes, current));
+		strand_.post([this, self, result] {
+			publish(*result);
+		});
+	});
+}
+
+/**
+ * @brief 把一批变更应用到成员表并生成新快照,在strand_之外执行,
+ *        同一时间只有一个重建在进行,成员表不需要加锁
+ * @param changes 按到达顺序排列的变更
+ * @param current 当前发布的快照
+ * @return rebuild_result
+ */
+chat_room::rebuild_result chat_room::rebuild(const std::vector<membership_change> &changes,
+											 const member_snapshot_ptr &current) {
+	rebuild_result result;
+	std::vector<bool> dirty(partition_members_.size(), false);
+	//本批中加入且最终仍在房间中的成员,同一批内加入又离开的不重放历史
+	ptr_slot_map<chat_participant, uint64_t> joined;
+	for (const auto &change : changes) {
+		if (change.join) {
+			//放到成员最少的分区
+			size_t index = 0;
+			for (size_t i = 1; i < partition_members_.size(); ++i) {
+				if (partition_members_[i].size() < partition_members_[index].size())
+					index = i;
+			}
+			if (!members_.insert(change.cp, index).second)
+				continue;
+			partition_members_[index].insert(change.cp);
+			joined.insert(change.cp, change.last_seq);
+			dirty[index] = true;
+		}
+		else {
+			auto member = members_.find(change.cp.get());
+			if (!member)
+				continue;
+			size_t index = member->value;
+			partition_members_[index].erase(change.cp.get());
+			members_.erase(change.cp.get());
+			joined.erase(change.cp.get());
+			dirty[index] = true;
+		}
+	}
+	result.partitioned = split_partitions();
+
+	auto snapshot = std::make_shared<member_snapshot>();
+	snapshot->size = members_.size();
+	snapshot->partitions.reserve(partition_members_.size());
+	for (size_t i = 0; i < partition_members_.size(); ++i) {
+		if (!result.partitioned && !dirty[i]) {
+			snapshot->partitions.push_back(current->partitions[i]);
+			continue;
+		}
+		auto list = std::make_shared<member_snapshot::member_list>();
+		list->reserve(partition_members_[i].size());
+		for (const auto &member : partition_members_[i])
+			list->push_back(member.key);
+		snapshot->partitions.push_back(std::move(list));
+	}
+	result.snapshot = std::move(snapshot);
+
+	for (const auto &member : joined)
+		result.joined.push_back(joiner{ member.key, members_.find(member.key.get())->value, member.value });
+	//从日志读历史可能缺页读盘,放在重建中进行,发布时只需补上之后新写入的几条
+	if (log_ && !result.joined.empty() && options_.history_depth > 0) {
+		result.history_end = log_->next_seq();
+		result.history = log_->read(result.history_end - std::min<uint64_t>(result.history_end, options_.history_depth),
+									result.history_end);
+	}
+	server_stats::instance().record_snapshot_rebuild(changes.size());
+	return result;
+}
+
+/**
+ * @brief 发布重建好的快照并给新成员重放历史,只在strand_中调用
+ * @param result 重建结果
+ * @return
+ */
+void chat_room::publish(rebuild_result &result) {
+	snapshot_ = std::move(result.snapshot);
+	if (result.partitioned) {
+		//不同房间的分区从不同的io_service开始,避免都落在第一个reactor上
+		for (size_t i = 0; i < snapshot_->partitions.size(); ++i) {
+			auto service = fanout_services_[(room_id_ + i) % fanout_services_.size()];
+			partition_strands_.emplace_back(new boost::asio::io_service::strand(*service));
+		}
+		server_stats::instance().record_room_partitioned();
+	}
+
+	//新成员从这个快照开始收到广播,之前的消息都在历史中,重放后既不重复也不遗漏
+	//整段历史作为一个消息批投递,一次投递、在发送队列中连续,不带序号的新成员共享同一批,
+	//带序号的只收到缺口部分
+	auto history = result.joined.empty() ? nullptr : replay_history(result);
+	auto self(shared_from_this());
+	for (const auto &joined : result.joined) {
+		chat_message_ptr marker;
+		auto replay = resume_from(history, joined.last_seq, marker);
+		if (!replay && !marker)
+			continue;
+		auto cp = joined.cp;
+		auto send = [cp, marker, replay] {
+			if (marker)
+				cp->deliver(marker);
+			if (replay)
+				cp->deliver(replay);
+		};
+		//历史在分区的strand中重放,保证排在之后的广播前面
+		if (partition_strands_.empty())
+			send();
+		else
+			partition_strands_[joined.partition]->post([self, send] {
+				send();
+			});
+	}
+
+	rebuilding_ = false;
+	if (!changes_.empty()) {
+		start_rebuild();
+	}
+	else if (snapshot_->size == 0 && joining_.empty() && empty_handler_) {
+		//回调会把房间移出房间表,先移出回调本身
+		auto handler = std::move(empty_handler_);
+		empty_handler_ = nullptr;
+		handler();
+	}
+}
+
+/**
+ * @brief 从准入队列中接纳至多join_batch个客户端,队列非空时继续定时
+ * @param
+ * @return
+ */
+void chat_room::admit_pending() {
+	int admitted = 0;
+	while (!join_queue_.empty() && admitted < options_.join_batch) {
+		auto handle = join_queue_.front();
+		join_queue_.pop_front();
+		auto entry = joining_.get(handle);
+		if (!entry)
+			continue;
+		auto cp = entry->key;
+		auto last_seq = entry->value;
+		joining_.erase(handle);
+		change_membership(cp, true, last_seq);
+		++admitted;
+	}
+
+	join_timer_armed_ = !join_queue_.empty() || admitted > 0;
+	if (!join_timer_armed_)
+		return;
+	join_timer_.expires_from_now(std::chrono::milliseconds(options_.join_interval_ms));
+	auto self(shared_from_this());
+	join_timer_.async_wait(strand_.wrap([this, self](boost::system::error_code ec) {
+		if (!ec)
+			admit_pending();
+	}));
+}
+
+/**
+ * @brief 把消息或消息批交给当前快照中的所有成员,分区后交给每个分区的strand
+ * @param msg 消息或消息批
+ * @return
+ */
+template <typename Message>
+void chat_room::fan_out(const Message &msg) {
+	if (partition_strands_.empty()) {
+		for (const auto &cp : *snapshot_->partitions.front())
+			cp->deliver(msg);
+		return;
+	}
+
+	//按顺序投递到各分区,每个分区内部按投递顺序执行,成员收到的顺序与房间一致
+	//投递时带上分区成员表的引用,之后发布的新快照不影响已投递的广播
+	auto self(shared_from_this());
+	for (size_t i = 0; i < snapshot_->partitions.size(); ++i) {
+		auto members = snapshot_->partitions[i];
+		if (members->empty())
+			continue;
+		partition_strands_[i]->post([self, members, msg] {
+			for (const auto &cp : *members)
+				cp->deliver(msg);
+		});
+	}
+}
+
+/**
+ * @brief 成员数达到fanout_threshold时把成员平均分到各分区,只在重建中调用
+ * @param
+ * @return bool 是否进行了拆分
+ */
+bool chat_room::split_partitions() {
+	if (partition_members_.size() > 1 || options_.fanout_threshold <= 0 || options_.fanout_partitions <= 1 ||
+		fanout_services_.empty() || members_.size() < size_t(options_.fanout_threshold))
+		return false;
+
+	std::vector<ptr_slot_map<chat_participant>> partitions(options_.fanout_partitions);
+	size_t next = 0;
+	for (auto &member : members_) {
+		member.value = next;
+		partitions[next].insert(member.key);
+		next = (next + 1) % partitions.size();
+	}
+	partition_members_.swap(partitions);
+	return true;
+}
+
+/**
+ * @brief 把消息记入历史,启用日志时追加到日志
+ * @param msg 编码好的共享消息帧
+ * @return
+ */
+void chat_room::remember(const chat_message_ptr &msg) {
+	if (!log_) {
+		history_.push(msg);
+		return;
+	}
+	log_->append(*msg);
+	schedule_log_sync();
+}
+
+/**
+ * @brief 取给新成员重放的历史,只在strand_中调用
+ * @param result 重建结果,启用日志时其中已有重建时读出的大部分历史
+ * @return chat_message_batch_ptr 没有历史时返回nullptr
+ */
+chat_message_batch_ptr chat_room::replay_history(const rebuild_result &result) {
+	if (!log_)
+		return history_.replay();
+
+	//重建之后到发布之前写入的消息还在页缓存中,补读很快
+	uint64_t end = log_->next_seq();
+	if (end <= result.history_end)
+		return result.history;
+	auto recent = log_->read(result.history_end, end);
+	if (!recent)
+		return result.history;
+	if (!result.history)
+		return recent;
+	size_t depth = size_t(options_.history_depth);
+	size_t total = result.history->size() + recent->size();
+	size_t skip = total > depth ? total - depth : 0;
+	auto history = std::make_shared<chat_message_batch>();
+	history->reserve(total - skip);
+	for (const auto *part : { result.history.get(), recent.get() }) {
+		for (const auto &msg : *part) {
+			if (skip > 0)
+				--skip;
+			else
+				history->push_back(msg);
+		}
+	}
+	return history;
+}
+
+/**
+ * @brief 按客户端最后收到的序号截取要重放的历史,只在strand_中调用
+ * @param history 完整的重放历史,可以为nullptr
+ * @param last_seq 客户端最后收到的序号,0表示重放全部
+ * @param marker 输出,缺口超出保留的历史时为MT_RESYNC_TOO_FAR消息,否则为nullptr
+ * @return chat_message_batch_ptr 要重放的消息,没有时返回nullptr
+ */
+chat_message_batch_ptr chat_room::resume_from(const chat_message_batch_ptr &history, uint64_t last_seq,
+											  chat_message_ptr &marker) {
+	if (last_seq == 0)
+		return history;
+
+	//历史中的第一条,没有历史时缺口从下一条广播开始
+	uint64_t first_seq = history ? room_seq_of(*history->front()) : next_seq_;
+	//序号不可能超过已分配的序号,来自房间的另一个实例;或者缺口之前的消息已不在历史中
+	if (last_seq >= next_seq_ || last_seq + 1 < first_seq) {
+		PResyncTooFar too_far;
+		too_far.set_room_id(room_id_);
+		too_far.set_last_seq(last_seq);
+		too_far.set_first_seq(first_seq);
+		auto msg = std::make_shared<chat_message>();
+		msg->set_message(MT_RESYNC_TOO_FAR, too_far.SerializeAsString());
+		marker = std::move(msg);
+		server_stats::instance().record_resync(true, 0);
+		return history;
+	}
+
+	if (!history) {
+		server_stats::instance().record_resync(false, 0);
+		return nullptr;
+	}
+	//历史按序号递增,二分找到第一条客户端没有收到的消息
+	auto begin = std::upper_bound(history->begin(), history->end(), last_seq,
+								  [](uint64_t seq, const chat_message_ptr &msg) {
+		return seq < room_seq_of(*msg);
+	});
+	size_t skipped = size_t(begin - history->begin());
+	server_stats::instance().record_resync(false, skipped);
+	if (begin == history->end())
+		return nullptr;
+	if (begin == history->begin())
+		return history;
+	return std::make_shared<chat_message_batch>(begin, history->end());
+}
+
+/**
+ * @brief 日志有新写入时启动定时器,到期后在strand_之外批量落盘并执行保留策略
+ * @param
+ * @return
+ */
+void chat_room::schedule_log_sync() {
+	if (log_timer_armed_)
+		return;
+	log_timer_armed_ = true;
+	//不要求落盘时也定期执行保留策略
+	int interval = log_->options().fsync_interval_ms > 0 ? log_->options().fsync_interval_ms : 1000;
+	log_timer_.expires_from_now(std::chrono::milliseconds(interval));
+	auto self(shared_from_this());
+	log_timer_.async_wait(strand_.wrap([this, self](boost::system::error_code ec) {
+		log_timer_armed_ = false;
+		if (ec)
+			return;
+		//落盘和压缩都可能阻塞,不占用分片的strand;期间的追加留给下一次
+		auto log = log_;
+		io_service_.post([log] {
+			if (log->options().fsync_interval_ms > 0)
+				server_stats::instance().record_log_sync(log->sync());
+			log->maintain();
+		});
+	}));
+}
@@ -0,0 +1,334 @@
+﻿#pragma once
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <boost/asio.hpp>
+#include "chat_history.h"
+#include "chat_message.h"
+#include "room_log.h"
+#include "slot_map.h"
+
+//广播帧只编码一次,房间历史和所有session的发送队列共享同一份只读数据,
+//最后一个引用(发送完成或移出历史)释放时帧才被释放
+//攒批广播时一个时间窗口内的所有消息组成chat_message_batch,所有接收者共享
+using chat_message_queue = std::deque<chat_message_ptr>;
+
+/**
+ * @brief 房间参数
+ */
+struct room_options {
+	//广播攒批的最大时间窗口(微秒),0表示每条消息立即广播
+	int batch_window_us = 0;
+	//一批最多的消息条数,达到后立即广播
+	int batch_max_msgs = 64;
+	//每个准入周期最多接纳的加入请求数(每个加入都要重放历史),0表示立即接纳
+	int join_batch = 0;
+	//准入周期(毫秒)
+	int join_interval_ms = 10;
+	//成员数达到该值后把成员分到多个分区并行广播,0表示不分区
+	int fanout_threshold = 1024;
+	//分区数,0表示与房间表的分片数相同
+	int fanout_partitions = 0;
+	//每个房间保留的历史消息条数,加入时重放,0表示不保留
+	//启用消息日志时历史从日志中读取,深度只受磁盘限制
+	int history_depth = 100;
+	//连接建立后是否自动加入大厅,关闭后客户端用带last_seq的MT_JOIN_ROOM加入大厅以续传
+	bool lobby_auto_join = true;
+	//消息日志,dir为空时历史只保存在内存中
+	room_log_options log;
+};
+
+/**
+ * @brief 房间成员,不同传输方式(asio socket、io_uring等)的客户端都实现此接口
+ */
+class chat_participant {
+public:
+	virtual ~chat_participant() {}
+
+	/**
+	 * @brief 将消息发送到客户端,只增加消息帧的引用计数,不拷贝消息
+	 * @param msg 编码好的共享消息帧
+	 * @return
+	 */
+	virtual void deliver(const chat_message_ptr &msg) = 0;
+
+	/**
+	 * @brief 一次发送一批消息,默认逐条调用deliver,
+	 *        实现方应尽量一次投递并合并为一次写
+	 * @param batch 共享的消息批
+	 * @return
+	 */
+	virtual void deliver(const chat_message_batch_ptr &batch) {
+		for (const auto &msg : *batch)
+			deliver(msg);
+	}
+};
+
+using chat_participant_ptr = std::shared_ptr<chat_participant>;
+
+/**
+ * @brief 房间成员的一个不可变快照,发布后不再修改
+ *        广播持有快照的shared_ptr即可在任意线程中无锁遍历,加入/离开不会阻塞正在进行的广播,
+ *        旧快照在最后一个引用它的广播结束后释放
+ */
+struct member_snapshot {
+	using member_list = std::vector<chat_participant_ptr>;
+
+	//每个分区的成员,未分区时只有一个,没有变化的分区在新旧快照间共享
+	std::vector<std::shared_ptr<const member_list>> partitions;
+	size_t size = 0;
+};
+
+using member_snapshot_ptr = std::shared_ptr<const member_snapshot>;
+
+/**
+ * @brief 一个聊天室,由room_registry按需创建,与同一分片的其他房间共用分片的strand,
+ *        除构造外的所有成员函数都只能在该strand中调用
+ *        广播遍历的是当前发布的成员快照;加入/离开只在strand中记下变更,
+ *        由一次在strand之外进行的重建合并所有积攒的变更并生成新快照,再回到strand中发布,
+ *        重建期间到来的变更留给下一次重建,大量加入/离开只触发少数几次重建
+ *        成员数达到fanout_threshold后,快照被分成多个分区,每个分区一个strand,
+ *        广播按顺序投递到所有分区,各分区并行地发给自己的成员,每个成员收到的顺序与房间一致
+ *        每条广播带有房间内单调递增的序号,重连的客户端带上最后收到的序号加入,只重放缺口
+ */
+class chat_room : public std::enable_shared_from_this<chat_room> {
+public:
+	//PRoomInformation.seq的占位值,编码时先写入占位值,房间在广播前原地改写为实际序号
+	enum : uint64_t { unstamped_seq = ~0ull };
+
+	/**
+	 * @brief 构造
+	 * @param io_service 房间定时器和快照重建所在的io_service
+	 * @param strand 房间所在分片的strand
+	 * @param room_id 房间id
+	 * @param options 房间参数
+	 * @param fanout_services 分区strand所在的io_service
+	 * @return 本类对象
+	 */
+	chat_room(boost::asio::io_service &io_service, boost::asio::io_service::strand &strand,
+			  uint64_t room_id, const room_options &options,
+			  const std::vector<boost::asio::io_service *> &fanout_services);
+
+	uint64_t id() const {
+		return room_id_;
+	}
+
+	/**
+	 * @brief 设置房间变空时的回调,在strand中调用,用于从房间表中回收房间
+	 * @param handler 回调
+	 * @return
+	 */
+	void set_empty_handler(std::function<void()> handler) {
+		empty_handler_ = std::move(handler);
+	}
+
+	/**
+	 * @brief 客户端加入事件
+	 * @param cp 客户端智能指针
+	 * @param last_seq 客户端在本房间最后收到的序号,0表示重放全部历史
+	 * @return
+	 */
+	void join(const chat_participant_ptr &cp, uint64_t last_seq = 0);
+
+	/**
+	 * @brief 客户端离开事件,在下一个快照发布后不再收到广播
+	 * @param cp 客户端智能指针
+	 * @return
+	 */
+	void leave(const chat_participant_ptr &cp);
+
+	/**
+	 * @brief 给所有客户端分发消息,先写入房间序号,之后消息帧不再修改
+	 * @param msg 编码好的消息帧,序号为unstamped_seq
+	 * @return
+	 */
+	void deliver(const std::shared_ptr<chat_message> &msg);
+
+private:
+	/**
+	 * @brief 一次成员变更
+	 */
+	struct membership_change {
+		chat_participant_ptr cp;
+		bool join;
+		uint64_t last_seq;
+	};
+
+	/**
+	 * @brief 一次重建中新加入的成员
+	 */
+	struct joiner {
+		chat_participant_ptr cp;
+		size_t partition;
+		uint64_t last_seq;
+	};
+
+	/**
+	 * @brief 一次重建的结果
+	 */
+	struct rebuild_result {
+		member_snapshot_ptr snapshot;
+		//本次新加入的成员及其分区,发布时给它们重放历史
+		std::vector<joiner> joined;
+		bool partitioned = false;
+		//启用日志时在重建中从日志读出的历史,以及读取时日志的末尾
+		chat_message_batch_ptr history;
+		uint64_t history_end = 0;
+	};
+
+	/**
+	 * @brief 立即把一条消息广播给所有客户端,只在strand_中调用
+	 * @param msg 编码好的共享消息帧
+	 * @return
+	 */
+	void deliver_now(const chat_message_ptr &msg);
+
+	/**
+	 * @brief 把攒下的消息作为一批广播给所有客户端,只在strand_中调用
+	 * @param
+	 * @return
+	 */
+	void flush_batch();
+
+	/**
+	 * @brief 更新消息到达间隔的滑动平均,并据此判断是否需要攒批
+	 * @param
+	 * @return bool 当前负载下一个窗口内是否预计有多条消息
+	 */
+	bool update_load();
+
+	/**
+	 * @brief 把消息记入历史,启用日志时追加到日志
+	 * @param msg 编码好的共享消息帧
+	 * @return
+	 */
+	void remember(const chat_message_ptr &msg);
+
+	/**
+	 * @brief 取给新成员重放的历史,只在strand_中调用
+	 * @param result 重建结果,启用日志时其中已有重建时读出的大部分历史
+	 * @return chat_message_batch_ptr 没有历史时返回nullptr
+	 */
+	chat_message_batch_ptr replay_history(const rebuild_result &result);
+
+	/**
+	 * @brief 按客户端最后收到的序号截取要重放的历史,只在strand_中调用
+	 * @param history 完整的重放历史,可以为nullptr
+	 * @param last_seq 客户端最后收到的序号,0表示重放全部
+	 * @param marker 输出,缺口超出保留的历史时为MT_RESYNC_TOO_FAR消息,否则为nullptr
+	 * @return chat_message_batch_ptr 要重放的消息,没有时返回nullptr
+	 */
+	chat_message_batch_ptr resume_from(const chat_message_batch_ptr &history, uint64_t last_seq,
+									   chat_message_ptr &marker);
+
+	/**
+	 * @brief 日志有新写入时启动定时器,到期后在strand_之外批量落盘并执行保留策略
+	 * @param
+	 * @return
+	 */
+	void schedule_log_sync();
+
+	/**
+	 * @brief 记下一次成员变更,没有进行中的重建时发起重建,只在strand_中调用
+	 * @param cp 客户端智能指针
+	 * @param join 加入还是离开
+	 * @param last_seq 加入时客户端最后收到的序号
+	 * @return
+	 */
+	void change_membership(const chat_participant_ptr &cp, bool join, uint64_t last_seq = 0);
+
+	/**
+	 * @brief 把积攒的变更交给一次重建,只在strand_中调用
+	 * @param
+	 * @return
+	 */
+	void start_rebuild();
+
+	/**
+	 * @brief 把一批变更应用到成员表并生成新快照,在strand_之外执行,
+	 *        同一时间只有一个重建在进行,成员表不需要加锁
+	 * @param changes 按到达顺序排列的变更
+	 * @param current 当前发布的快照
+	 * @return rebuild_result
+	 */
+	rebuild_result rebuild(const std::vector<membership_change> &changes, const member_snapshot_ptr &current);
+
+	/**
+	 * @brief 发布重建好的快照并给新成员重放历史,只在strand_中调用
+	 * @param result 重建结果
+	 * @return
+	 */
+	void publish(rebuild_result &result);
+
+	/**
+	 * @brief 从准入队列中接纳至多join_batch个客户端,队列非空时继续定时
+	 * @param
+	 * @return
+	 */
+	void admit_pending();
+
+	/**
+	 * @brief 把消息或消息批交给当前快照中的所有成员,分区后交给每个分区的strand
+	 * @param msg 消息或消息批
+	 * @return
+	 */
+	template <typename Message>
+	void fan_out(const Message &msg);
+
+	/**
+	 * @brief 成员数达到fanout_threshold时把成员平均分到各分区,只在重建中调用
+	 * @param
+	 * @return bool 是否进行了拆分
+	 */
+	bool split_partitions();
+
+private:
+	boost::asio::io_service &io_service_;
+	boost::asio::io_service::strand &strand_;
+	chat_history history_;
+	//消息日志,为空时历史只在history_中
+	std::shared_ptr<room_log> log_;
+	boost::asio::steady_timer log_timer_;
+	bool log_timer_armed_ = false;
+	//下一条广播的序号
+	uint64_t next_seq_;
+
+	//当前发布的成员快照,只在strand_中读写,广播时复制一份引用带到分区的strand中
+	member_snapshot_ptr snapshot_;
+	//等待下一次重建的变更
+	std::vector<membership_change> changes_;
+	bool rebuilding_ = false;
+	std::function<void()> empty_handler_;
+
+	//成员表,只在重建中访问:成员及其所在的分区,以及每个分区的成员
+	ptr_slot_map<chat_participant, size_t> members_;
+	std::vector<ptr_slot_map<chat_participant>> partition_members_;
+
+	//攒批广播
+	boost::asio::steady_timer timer_;
+	room_options options_;
+	chat_message_batch pending_;
+	//每次flush后加一,用来丢弃过期的定时器回调
+	unsigned batch_generation_ = 0;
+	bool timer_armed_ = false;
+	std::chrono::steady_clock::time_point last_arrival_;
+	//消息到达间隔的滑动平均(微秒)
+	double avg_interval_us_ = 1e9;
+
+	//加入准入队列,重连风暴时把历史重放分摊到多个周期
+	boost::asio::steady_timer join_timer_;
+	//队列中是joining_的句柄,排队期间离开的客户端句柄失效,出队时跳过
+	std::deque<slot_handle> join_queue_;
+	//仍在排队的客户端及其最后收到的序号
+	ptr_slot_map<chat_participant, uint64_t> joining_;
+	bool join_timer_armed_ = false;
+
+	uint64_t room_id_;
+
+	//并行广播的分区所在的strand,与快照的分区一一对应,为空表示直接在房间的strand中广播
+	const std::vector<boost::asio::io_service *> &fanout_services_;
+	std::vector<std::unique_ptr<boost::asio::io_service::strand>> partition_strands_;
+};
@@ -1,5 +1,7 @@
 ﻿#include <iostream>
+#include <algorithm>
 #include <deque>
+#include <functional>
 #include <list>
 #include <memory>
 #include <set>
@@ -9,86 +11,112 @@
 #include <thread>
 #include <cstdlib>
 #include <boost/asio.hpp>
-#include "serialize_object.h"
-#include "json_object.h"
 #include "protocol.pb.h"
 #include "chat_message.h"
+#include "chat_room.h"
+#include "room_registry.h"
+#include "session_directory.h"
+#include "cluster_node.h"
+#include "chat_proxy.h"
+#include "chat_handler.h"
+#include "chat_codec.h"
+#include "server_config.h"
+#include "io_service_pool.h"
+#include "server_stats.h"
+#include "receive_buffer.h"
+#include "uring_server.h"
+#include "send_queue.h"
+#include "shm_stream.h"
 #pragma comment(lib, "libboost_exception-vc141-mt-gd-x32-1_72.lib")
 using namespace std;
 using namespace boost::asio::ip;
 
-using chat_message_queue = deque<chat_message>;
-
-class chat_session;
-
-//room
-class chat_room {
+//client,Stream可以是tcp socket、Unix域socket或共享内存流,Codec是客户端协商的编码(见chat_codec.h)
+template <typename Stream, typename Codec = protobuf_codec>
+class basic_chat_session :
+	public chat_participant,
+	public std::enable_shared_from_this<basic_chat_session<Stream, Codec>>{
 public:
-	using chat_session_ptr = shared_ptr<chat_session>;
-
-	chat_room(boost::asio::io_service &io_service) 
-	: strand_(io_service){
+	basic_chat_session(Stream socket, room_registry &rooms, session_directory &names, boost::asio::io_service& io_service,
+		const send_queue_options &queue_options = send_queue_options())
+		: strand_(io_service), socket_(std::move(socket)), handler_(rooms, names), write_msgs_(queue_options) {
 
 	}
 
 	/**
-	 * @brief 客户端加入事件
-	 * @param cp 客户端智能指针
-	 * @return
-	 */
-	void join(chat_session_ptr cp);
-
-	/**
-	 * @brief 客户端离开事件
-	 * @param cp 客户端智能指针
+	 * @brief 加入大厅并开始读取消息
+	 * @param
 	 * @return
 	 */
-	void leave(chat_session_ptr cp);
+	void start() {
+		auto self(this->shared_from_this());
+		strand_.dispatch([this, self] {
+			handler_.start(self);
+			//编码协商时多读到的帧先处理
+			if (handle_frames() < 0) {
+				handler_.stop();
+				return;
+			}
+			do_read();
+		});
+	}
 
 	/**
-	 * @brief 给所有客户端分发消息
-	 * @param msg 消息引用
+	 * @brief 接着编码协商开始会话
+	 * @param received 协商时已读到、尚未处理的数据
 	 * @return
 	 */
-	void deliver(const chat_message &msg);
-
-private:
-	boost::asio::io_service::strand strand_;
-	set<chat_session_ptr> chat_sessions_;
-	chat_message_queue recent_msgs_;
-	enum { max_recent_msgs = 100 };
-};
-
-//client
-class chat_session :
-	public std::enable_shared_from_this<chat_session>{
-public:
-	chat_session(tcp::socket socket, chat_room &room, boost::asio::io_service& io_service)
-		: socket_(std::move(socket)), room_(room), strand_(io_service) {
-
+	void start(receive_buffer &&received) {
+		read_buffer_ = std::move(received);
+		start();
 	}
 
 	/**
-	 * @brief 触发客户端加入事件并读取消息头
-	 * @param
+	 * @brief 将消息发送到客户端,protobuf客户端只增加消息帧的引用计数,不拷贝消息,
+	 *        其他编码的客户端在本连接的strand中转换
+	 * @param msg 编码好的共享消息帧
 	 * @return
 	 */
-	void start() {
-		room_.join(shared_from_this());
-		do_read_header();
+	void deliver(const chat_message_ptr &msg) override {
+		auto self(this->shared_from_this());
+		strand_.post([this, self, msg] {
+			if (closed_)
+				return;
+			const chat_message_ptr &out = Codec::encode(msg);
+			if (!out)
+				return;
+			bool write_in_progress = !write_msgs_.empty();
+			if (!write_msgs_.push(out)) {
+				close();
+				return;
+			}
+			if (!write_in_progress && !write_msgs_.empty()) {
+				// first
+				do_write();
+			}
+		});
 	}
 
 	/**
-	 * @brief 将消息发送到服务端
-	 * @param msg 消息引用
+	 * @brief 一次投递一批消息,整批在同一个strand回调中连续进入发送队列,
+	 *        再按do_write的上限分几次gather write发出
+	 * @param batch 共享的消息批
 	 * @return
 	 */
-	void deliver(const chat_message &msg) {
-		strand_.post([this, msg] {
+	void deliver(const chat_message_batch_ptr &batch) override {
+		auto self(this->shared_from_this());
+		strand_.post([this, self, batch] {
+			if (closed_)
+				return;
 			bool write_in_progress = !write_msgs_.empty();
-			write_msgs_.push_back(msg);
-			if (!write_in_progress) {
-				// first
+			for (const auto &msg : *batch) {
+				const chat_message_ptr &out = Codec::encode(msg);
+				if (out && !write_msgs_.push(out)) {
+					close();
+					return;
+				}
+			}
+			if (!write_in_progress && !write_msgs_.empty()) {
 				do_write();
 			}
 		});
@@ -96,208 +124,348 @@ public:
 
 private:
 	/**
-	 * @brief 读取消息头
+	 * @brief 发送队列超限时断开慢客户端,只在strand_中调用
 	 * @param
 	 * @return
 	 */
-	void do_read_header() {
-		auto self(shared_from_this());
-		boost::asio::async_read(
-			socket_,
-			boost::asio::buffer(read_msg_.data(), chat_message::header_length),
-			strand_.wrap(
-			[this, self](boost::system::error_code ec, size_t) {
-				if (!ec && read_msg_.decode_header()) {
-					do_read_body();
-				}
-				else {
-					room_.leave(shared_from_this());
-				}
-			})
-		);
+	void close() {
+		closed_ = true;
+		handler_.stop();
+		boost::system::error_code ec;
+		socket_.close(ec);
 	}
 
 	/**
-	 * @brief 读取消息体
+	 * @brief 用async_read_some尽量多地读取数据,并一次解析出所有完整的帧
 	 * @param
 	 * @return
 	 */
-	void do_read_body() {
-		auto self(shared_from_this());
-		boost::asio::async_read(
-			socket_,
-			boost::asio::buffer(read_msg_.body(), read_msg_.body_length()),
+	void do_read() {
+		auto self(this->shared_from_this());
+		socket_.async_read_some(
+			boost::asio::buffer(read_buffer_.write_data(), read_buffer_.write_size()),
 			strand_.wrap(
-			[this, self](boost::system::error_code ec, size_t) {
+			[this, self](boost::system::error_code ec, size_t length) {
 				if (!ec) {
-					//room_.deliver(read_msg_);
-					handle_message();
-					do_read_header();
-				}
-				else {
-					room_.leave(shared_from_this());
+					read_buffer_.commit(length);
+					auto frames = handle_frames();
+					if (frames >= 0) {
+						server_stats::instance().record_read(frames);
+						do_read();
+						return;
+					}
 				}
+				handler_.stop();
 			})
 		);
 	}
 
 	/**
-	 * @brief 根据读到的消息反序列化程指定的类
-	 * @param
-	 * @return T 自定义类型
-	 */
-	template<typename T>
-	T serialize_object() {
-		T t;
-		stringstream ss(string(read_msg_.body(), read_msg_.body() + read_msg_.body_length()));
-		boost::archive::text_iarchive ia(ss);
-		ia & t;
-		return t;
-	}
-
-	/**
-	 * @brief 将收到的消息体转换为ptree，认为是json
-	 * @param
-	 * @return
-	 */
-	ptree to_ptree() {
-		ptree obj;
-		std::stringstream ss(
-			std::string(read_msg_.body(),
-				read_msg_.body() + read_msg_.body_length()));
-		boost::property_tree::read_json(ss, obj);
-		return obj;
-	}
-
-	/**
-	 * @brief 使用protobuf解析消息
+	 * @brief 按本连接的编码处理接收缓冲区中所有完整的帧
 	 * @param
-	 * @return
+	 * @return int 处理的帧数,消息头非法时返回-1
 	 */
-	bool fill_protobuf(::google::protobuf::Message *msg) {
-		string str(read_msg_.body(),
-				   read_msg_.body() + read_msg_.body_length());
-		return msg->ParseFromString(str);
+	int handle_frames() {
+		return parse_frames(read_buffer_, [this](int type, const char *body, size_t body_length) {
+			Codec::decode(handler_, type, body, body_length);
+		});
 	}
 
 	/**
-	 * @brief 根据消息类型处理消息
+	 * @brief 将消息队列中已有的消息合并为一次gather write发送,
+	 *        单次最多max_write_batch_msgs条或max_write_batch_bytes字节,至少一条,直至队列为空
 	 * @param
 	 * @return
 	 */
-	void handle_message() {
-		auto type = read_msg_.type();
-		if (type == MT_BIND_NAME) {
-			PBindName bind_name;
-			auto ok = fill_protobuf(&bind_name);
-			if (ok) {
-				bind_name_string_ = bind_name.name();
-			}
-		}
-		else if (type == MT_CHAT_INFO) {
-			PChat chat;
-			auto ok = fill_protobuf(&chat);
-			if (ok) {
-				chat_information_string_ = chat.information();
-				auto rinfo = build_room_info();
-				chat_message msg;
-				msg.set_message(MT_ROOM_INFO, rinfo);
-				room_.deliver(msg);
-			}
-		}
-		else {
-			
+	void do_write() {
+		auto self(this->shared_from_this());
+
+		write_buffers_.clear();
+		size_t batch_bytes = 0;
+		for (const auto &msg : write_msgs_) {
+			if (!write_buffers_.empty() &&
+				(write_buffers_.size() >= max_write_batch_msgs ||
+				 batch_bytes + msg->length() > max_write_batch_bytes))
+				break;
+			write_buffers_.push_back(boost::asio::buffer(msg->data(), msg->length()));
+			batch_bytes += msg->length();
 		}
-	}
-	
-	/**
-	 * @brief 根据绑定好的名字构造一个聊天室信息
-	 * @param
-	 * @return string 返回一个序列化好了的聊天室信息
-	 */
-	string build_room_info() {
-		PRoomInformation info;
-		info.set_name(bind_name_string_);
-		info.set_information(chat_information_string_);
-		return info.SerializeAsString();
-	}
+		write_msgs_.set_in_flight(write_buffers_.size());
 
-	/**
-	 * @brief 重复发送消息队列中第一条,直至发送完成
-	 * @param
-	 * @return
-	 */
-	void do_write() {
-		auto self(shared_from_this());
-			
 		boost::asio::async_write(
 			socket_,
-			boost::asio::buffer(write_msgs_.front().data(), write_msgs_.front().length()),
+			write_buffers_,
 			strand_.wrap(
-			[this, self](boost::system::error_code ec, size_t) {
+			[this, self](boost::system::error_code ec, size_t length) {
 				if (!ec) {
-					write_msgs_.pop_front();
-					if (!write_msgs_.empty()) {
+					auto count = write_buffers_.size();
+					server_stats::instance().record_flush(count, length);
+					write_msgs_.pop_front(count);
+					if (!write_msgs_.empty() && !closed_) {
 						do_write();
 					}
 				}
 				else {
-					room_.leave(shared_from_this());
+					handler_.stop();
 				}
 			})
 		);
 	}
 	
 private:
+	//单次gather write的上限,64与asio单次系统调用的iovec上限一致
+	enum { max_write_batch_msgs = 64 };
+	enum { max_write_batch_bytes = 64 * 1024 };
+
 	boost::asio::io_service::strand strand_;
-	tcp::socket socket_;
-	chat_room &room_;
-	chat_message read_msg_;
-	chat_message_queue write_msgs_;
-	string bind_name_string_;
-	string chat_information_string_;
+	Stream socket_;
+	chat_handler handler_;
+	receive_buffer read_buffer_;
+	send_queue write_msgs_;
+	bool closed_ = false;
+	//正在发送中的消息对应的buffer,发送完成前不可修改
+	vector<boost::asio::const_buffer> write_buffers_;
 };
 
+using chat_session = basic_chat_session<tcp::socket>;
 
 /**
- * @brief 客户端加入事件
- * @param cp 客户端智能指针
- * @return
+ * @brief 连接日志,在单独的线程中输出,不占用accept路径
  */
-void chat_room::join(chat_session_ptr cp) {
-	strand_.post([this, cp] {
-		chat_sessions_.insert(cp);
-		for (const auto &msg : recent_msgs_)
-			cp->deliver(msg);
-	});
-}
+class connection_logger {
+public:
+	static connection_logger &instance() {
+		static connection_logger logger;
+		return logger;
+	}
+
+	/**
+	 * @brief 投递一条客户端加入的日志
+	 * @param peer 客户端地址
+	 * @return
+	 */
+	void log_join(const tcp::endpoint &peer) {
+		io_service_.post([peer] {
+			cout << peer.address() << ":" << peer.port() << " join" << endl;
+		});
+	}
+
+	/**
+	 * @brief 投递一条本机客户端加入的日志
+	 * @param transport 传输方式
+	 * @param path 监听路径
+	 * @return
+	 */
+	void log_join(const string &transport, const string &path) {
+		io_service_.post([transport, path] {
+			cout << transport << ":" << path << " join" << endl;
+		});
+	}
+
+private:
+	connection_logger()
+		: work_(new boost::asio::io_service::work(io_service_)),
+		  thread_([this]() { io_service_.run(); }) {
+	}
+
+	~connection_logger() {
+		work_.reset();
+		thread_.join();
+	}
+
+private:
+	boost::asio::io_service io_service_;
+	unique_ptr<boost::asio::io_service::work> work_;
+	thread thread_;
+};
 
 /**
- * @brief 客户端离开事件
- * @param cp 客户端智能指针
- * @return
+ * @brief 编码协商: 等待客户端的第一帧,是MT_CODEC_HELLO时按客户端的偏好选择编码并回复MT_CODEC_SELECT,
+ *        第一帧是其他消息或超时未收到时按protobuf处理,已读到的数据交给随后创建的会话
  */
-void chat_room::leave(chat_session_ptr cp) {
-	strand_.post([this, cp] {
-		chat_sessions_.erase(cp);
-	});
-}
+template <typename Stream>
+class codec_handshake : public std::enable_shared_from_this<codec_handshake<Stream>> {
+public:
+	using session_factory = std::function<void(Stream, int, receive_buffer)>;
+
+	codec_handshake(Stream socket, boost::asio::io_service &io_service, const codec_options &options,
+		session_factory factory)
+		: socket_(std::move(socket)), strand_(io_service), timer_(io_service), options_(options),
+		  factory_(std::move(factory)) {
+	}
+
+	void start() {
+		auto self(this->shared_from_this());
+		timer_.expires_from_now(std::chrono::milliseconds(options_.handshake_timeout_ms));
+		timer_.async_wait(strand_.wrap([this, self](boost::system::error_code ec) {
+			if (ec || done_)
+				return;
+			//取消进行中的读取,在读取的回调中按protobuf开始会话
+			timed_out_ = true;
+			socket_.cancel(ec);
+		}));
+		do_read();
+	}
+
+private:
+	void do_read() {
+		auto self(this->shared_from_this());
+		socket_.async_read_some(
+			boost::asio::buffer(read_buffer_.write_data(), read_buffer_.write_size()),
+			strand_.wrap([this, self](boost::system::error_code ec, size_t length) {
+				if (ec) {
+					if (timed_out_)
+						finish(CODEC_PROTOBUF);
+					else
+						timer_.cancel();
+					return;
+				}
+				read_buffer_.commit(length);
+				if (read_buffer_.size() < chat_message::header_length) {
+					read_buffer_.prepare();
+					do_read();
+					return;
+				}
+				Header header;
+				memcpy(&header, read_buffer_.data(), chat_message::header_length);
+				if (header.type_ != MT_CODEC_HELLO || header.body_size_ < 0 || header.body_size_ > max_hello_length) {
+					finish(CODEC_PROTOBUF);
+					return;
+				}
+				size_t frame_length = chat_message::header_length + header.body_size_;
+				if (read_buffer_.size() < frame_length) {
+					read_buffer_.prepare(frame_length);
+					do_read();
+					return;
+				}
+				int codec = choose_codec(options_, read_buffer_.data() + chat_message::header_length, header.body_size_);
+				read_buffer_.consume(frame_length);
+				select(codec);
+			}));
+	}
+
+	/**
+	 * @brief 回复选中的编码,发送完成后再创建会话,保证回复在会话的所有消息之前
+	 * @param codec 选中的编码
+	 * @return
+	 */
+	void select(int codec) {
+		auto self(this->shared_from_this());
+		done_ = true;
+		timer_.cancel();
+		char body = char(codec);
+		reply_.set_message(MT_CODEC_SELECT, &body, 1);
+		boost::asio::async_write(socket_, boost::asio::buffer(reply_.data(), reply_.length()),
+			strand_.wrap([this, self, codec](boost::system::error_code ec, size_t) {
+				if (!ec)
+					factory_(std::move(socket_), codec, std::move(read_buffer_));
+			}));
+	}
+
+	void finish(int codec) {
+		done_ = true;
+		timer_.cancel();
+		factory_(std::move(socket_), codec, std::move(read_buffer_));
+	}
+
+private:
+	//MT_CODEC_HELLO消息体的上限,每个编码一个字节
+	enum { max_hello_length = 16 };
+
+	Stream socket_;
+	boost::asio::io_service::strand strand_;
+	boost::asio::steady_timer timer_;
+	const codec_options &options_;
+	session_factory factory_;
+	receive_buffer read_buffer_;
+	chat_message reply_;
+	bool done_ = false;
+	bool timed_out_ = false;
+};
+
+#ifdef CHAT_SERVER_HAS_SHM
+using local_stream = boost::asio::local::stream_protocol;
 
 /**
- * @brief 给所有客户端分发消息
- * @param msg 消息引用
- * @return
+ * @brief 共享内存连接的握手: 客户端在Unix域socket上发送一帧MT_SHM_ATTACH,消息体为希望的环容量(十进制,空为默认),
+ *        服务端创建共享内存段,回复一帧空的MT_SHM_ATTACH并附带段的描述符,之后以该socket作为门铃创建会话
  */
-void chat_room::deliver(const chat_message &msg) {
-	strand_.post([this, msg] {
-		recent_msgs_.push_back(msg);
-		while (recent_msgs_.size() > max_recent_msgs)
-			recent_msgs_.pop_front();
-
-		for (auto &p : chat_sessions_)
-			p->deliver(msg);
-	});
-}
+class shm_handshake : public std::enable_shared_from_this<shm_handshake> {
+public:
+	using session_factory = std::function<void(shm_stream)>;
+
+	shm_handshake(local_stream::socket socket, boost::asio::io_service &io_service, session_factory factory)
+		: socket_(std::move(socket)), io_service_(io_service), factory_(std::move(factory)) {
+	}
+
+	void start() {
+		auto self(shared_from_this());
+		boost::asio::async_read(socket_,
+			boost::asio::buffer(attach_msg_.data(), chat_message::header_length),
+			[this, self](boost::system::error_code ec, size_t) {
+				if (!ec && attach_msg_.decode_header() && attach_msg_.type() == MT_SHM_ATTACH &&
+					attach_msg_.body_length() <= max_request_length) {
+					read_request();
+				}
+			});
+	}
+
+private:
+	void read_request() {
+		auto self(shared_from_this());
+		boost::asio::async_read(socket_,
+			boost::asio::buffer(attach_msg_.body(), attach_msg_.body_length()),
+			[this, self](boost::system::error_code ec, size_t) {
+				if (ec)
+					return;
+				string request(attach_msg_.body(), attach_msg_.body() + attach_msg_.body_length());
+				size_t ring_size = request.empty() ? size_t(shm_segment::default_ring_size)
+												   : size_t(strtoull(request.c_str(), nullptr, 10));
+				segment_ = shm_segment::create(ring_size, ec);
+				if (ec) {
+					cerr << "create shared memory of " << ring_size << " bytes failed: " << ec.message() << endl;
+					return;
+				}
+				send_segment();
+			});
+	}
+
+	/**
+	 * @brief socket可写时回复MT_SHM_ATTACH并传出段的描述符
+	 * @param
+	 * @return
+	 */
+	void send_segment() {
+		auto self(shared_from_this());
+		socket_.async_wait(local_stream::socket::wait_write, [this, self](boost::system::error_code ec) {
+			if (ec)
+				return;
+			chat_message reply;
+			reply.set_message(MT_SHM_ATTACH, string());
+			shm_segment::send_fd(socket_.native_handle(), reply.data(), reply.length(), segment_.fd(), ec);
+			if (ec) {
+				cerr << "send shared memory failed: " << ec.message() << endl;
+				return;
+			}
+			segment_.close_fd();
+			factory_(shm_stream(io_service_, std::move(socket_), std::move(segment_), true));
+		});
+	}
+
+private:
+	enum { max_request_length = 20 };
+
+	local_stream::socket socket_;
+	boost::asio::io_service &io_service_;
+	session_factory factory_;
+	chat_message attach_msg_;
+	shm_segment segment_;
+};
+#endif
+
+#ifdef SO_REUSEPORT
+using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
 
 //chat server
 class chat_server {
@@ -305,72 +473,417 @@ public:
 	/**
 	 * @brief 构造函数,并投递一个接受客户端的任务
 	 * @param io_service
+	 * @param rooms 所有chat_server共享的房间表
+	 * @param names 所有chat_server共享的在线名字表
 	 * @param endpoint 服务端协议和端口
 	 * @param server_id 测试用,本服务的id
+	 * @param reuse_port 是否设置SO_REUSEPORT,由内核在多个acceptor间分配连接
+	 * @param config 服务配置,使用其中的发送队列参数
 	 * @return 返回当前类对象
 	 */
-	chat_server(boost::asio::io_service &io_service,
-		const tcp::endpoint &endpoint, int server_id = -1) 
-		: room_(io_service), io_service_(io_service), acceptor_(io_service, endpoint), socket_(io_service), server_id_(server_id) {
+	chat_server(boost::asio::io_service &io_service, room_registry &rooms, session_directory &names,
+		const tcp::endpoint &endpoint, int server_id = -1, bool reuse_port = false,
+		const server_config &config = server_config()) 
+		: server_id_(server_id), acceptor_(io_service), io_service_(io_service), rooms_(rooms), names_(names),
+		  queue_options_(config.queue), codec_options_(config.codec), log_connections_(config.log_connections) {
+		open_acceptor(endpoint, reuse_port);
 		cout << "server " << server_id << " start!" << endl;
-		do_accept();
+		for (int i = 0; i < config.accept_concurrency; ++i) {
+			accept_slots_.emplace_back(new accept_slot(io_service));
+			do_accept(*accept_slots_.back());
+		}
 	}
 
+#ifdef CHAT_SERVER_HAS_SHM
+	/**
+	 * @brief 在Unix域socket上接受本机客户端,加入本服务的房间
+	 * @param path socket路径,已存在时先删除
+	 * @param shm true时该socket只用于握手和门铃,数据走共享内存环
+	 * @return
+	 */
+	void listen_local(const string &path, bool shm) {
+		::unlink(path.c_str());
+		local_acceptors_.emplace_back(new local_listener(io_service_, path, shm));
+		do_accept_local(*local_acceptors_.back());
+	}
+#endif
+
 private:
 	/**
-	 * @brief 接受新客户端
-	 * @param
+	 * @brief 打开并监听acceptor
+	 * @param endpoint 服务端协议和端口
+	 * @param reuse_port 是否设置SO_REUSEPORT
+	 * @return
+	 */
+	void open_acceptor(const tcp::endpoint &endpoint, bool reuse_port) {
+		acceptor_.open(endpoint.protocol());
+		acceptor_.set_option(tcp::acceptor::reuse_address(true));
+#ifdef SO_REUSEPORT
+		if (reuse_port)
+			acceptor_.set_option(::reuse_port(true));
+#endif
+		acceptor_.bind(endpoint);
+		acceptor_.listen();
+	}
+
+	/**
+	 * @brief 一个进行中的accept,每个chat_server同时挂着accept_concurrency个
+	 */
+	struct accept_slot {
+		explicit accept_slot(boost::asio::io_service &io_service)
+			: socket(io_service) {
+		}
+
+		tcp::socket socket;
+		tcp::endpoint peer;
+	};
+
+	/**
+	 * @brief 接受新客户端,对端地址由accept直接返回,日志交给connection_logger
+	 * @param slot 本次accept使用的socket和地址
 	 * @return
 	 */
-	void do_accept() {
-		acceptor_.async_accept(socket_, [this](boost::system::error_code ec) {
+	void do_accept(accept_slot &slot) {
+		acceptor_.async_accept(slot.socket, slot.peer, [this, &slot](boost::system::error_code ec) {
 			if (!ec) {
-				
-				cout << socket_.remote_endpoint().address()
-					 << ":" << socket_.remote_endpoint().port() << " join" << endl;
-				auto session = make_shared<chat_session>(std::move(socket_), room_, io_service_);
-				session->start();
+				server_stats::instance().record_accept();
+				if (log_connections_)
+					connection_logger::instance().log_join(slot.peer);
+				start_session(std::move(slot.socket));
 			}
-			do_accept();
+			do_accept(slot);
 		});
 	}
+
+	/**
+	 * @brief 为新连接创建会话,配置了其他编码时先进行编码协商
+	 * @param stream 已连接的流
+	 * @return
+	 */
+	template <typename Stream>
+	void start_session(Stream stream) {
+		if (!codec_options_.handshake()) {
+			make_session<Stream, protobuf_codec>(std::move(stream), receive_buffer());
+			return;
+		}
+		auto handshake = make_shared<codec_handshake<Stream>>(std::move(stream), io_service_, codec_options_,
+			[this](Stream negotiated, int codec, receive_buffer received) {
+				start_codec_session(std::move(negotiated), codec, std::move(received));
+			});
+		handshake->start();
+	}
+
+	/**
+	 * @brief 按协商出的编码实例化会话,编码只在这里分派一次
+	 * @param stream 已连接的流
+	 * @param codec 协商出的编码
+	 * @param received 协商时已读到、尚未处理的数据
+	 * @return
+	 */
+	template <typename Stream>
+	void start_codec_session(Stream stream, int codec, receive_buffer &&received) {
+		server_stats::instance().record_codec(codec);
+		switch (codec) {
+		case CODEC_RAW:
+			make_session<Stream, raw_codec>(std::move(stream), std::move(received));
+			break;
+		case CODEC_TEXT:
+			make_session<Stream, text_codec>(std::move(stream), std::move(received));
+			break;
+		case CODEC_JSON:
+			make_session<Stream, json_codec>(std::move(stream), std::move(received));
+			break;
+		case CODEC_FLAT:
+			make_session<Stream, flat_codec>(std::move(stream), std::move(received));
+			break;
+		default:
+			make_session<Stream, protobuf_codec>(std::move(stream), std::move(received));
+			break;
+		}
+	}
+
+	template <typename Stream, typename Codec>
+	void make_session(Stream stream, receive_buffer &&received) {
+		auto session = make_shared<basic_chat_session<Stream, Codec>>(
+			std::move(stream), rooms_, names_, io_service_, queue_options_);
+		session->start(std::move(received));
+	}
 	
+#ifdef CHAT_SERVER_HAS_SHM
+	/**
+	 * @brief 一个Unix域socket监听
+	 */
+	struct local_listener {
+		local_listener(boost::asio::io_service &io_service, const string &path, bool shm)
+			: acceptor(io_service, local_stream::endpoint(path)), socket(io_service), path(path), shm(shm) {
+		}
+
+		local_stream::acceptor acceptor;
+		local_stream::socket socket;
+		string path;
+		bool shm;
+	};
+
+	/**
+	 * @brief 接受本机客户端,shm模式下先完成共享内存握手
+	 * @param listener 本次accept使用的监听
+	 * @return
+	 */
+	void do_accept_local(local_listener &listener) {
+		listener.acceptor.async_accept(listener.socket, [this, &listener](boost::system::error_code ec) {
+			if (!ec) {
+				server_stats::instance().record_accept();
+				if (log_connections_)
+					connection_logger::instance().log_join(listener.shm ? "shm" : "unix", listener.path);
+				if (listener.shm) {
+					auto handshake = make_shared<shm_handshake>(std::move(listener.socket), io_service_,
+						[this](shm_stream stream) {
+							//共享内存流不支持取消读取,不做编码协商
+							make_session<shm_stream, protobuf_codec>(std::move(stream), receive_buffer());
+						});
+					handshake->start();
+				}
+				else {
+					start_session(std::move(listener.socket));
+				}
+			}
+			do_accept_local(listener);
+		});
+	}
+#endif
+
 private:
 	int server_id_ = -1;
 	tcp::acceptor acceptor_;
 	boost::asio::io_service &io_service_;
-	tcp::socket socket_;
-	chat_room room_;
+	vector<unique_ptr<accept_slot>> accept_slots_;
+#ifdef CHAT_SERVER_HAS_SHM
+	vector<unique_ptr<local_listener>> local_acceptors_;
+#endif
+	room_registry &rooms_;
+	session_directory &names_;
+	send_queue_options queue_options_;
+	codec_options codec_options_;
+	bool log_connections_;
 };
 
-int main(int argc, const char *const *argv) {
-	int server_port = 8000;
-	int server_num = 2;
-	if (argc >= 2) {
-		server_port = atoi(argv[1]);
+/**
+ * @brief 定时打印统计信息
+ */
+class stats_reporter {
+public:
+	/**
+	 * @brief 构造,interval为0时不做任何事
+	 * @param io_service
+	 * @param interval 打印间隔(秒)
+	 * @return 本类对象
+	 */
+	stats_reporter(boost::asio::io_service &io_service, int interval)
+		: timer_(io_service), interval_(interval) {
+		if (interval_ > 0)
+			do_wait();
+	}
+
+private:
+	void do_wait() {
+		timer_.expires_from_now(boost::asio::chrono::seconds(interval_));
+		timer_.async_wait([this](boost::system::error_code ec) {
+			if (!ec) {
+				server_stats::instance().print(cout);
+				do_wait();
+			}
+		});
+	}
+
+private:
+	boost::asio::steady_timer timer_;
+	int interval_;
+};
+
+/**
+ * @brief 按配置加入集群,其他节点转发来的广播只投递给本地成员
+ * @param io_service 节点链路所在的io_service
+ * @param rooms 本节点的房间表
+ * @param config 服务配置
+ * @return unique_ptr<cluster_node> 未配置集群时返回nullptr
+ */
+unique_ptr<cluster_node> start_cluster(boost::asio::io_service &io_service, room_registry &rooms,
+									   const server_config &config) {
+	if (!config.cluster.enabled())
+		return nullptr;
+	unique_ptr<cluster_node> cluster(new cluster_node(io_service, config.cluster,
+		[&rooms](uint64_t room_id, const std::shared_ptr<chat_message> &msg) {
+			rooms.deliver(room_id, msg, false);
+		}));
+	rooms.set_cluster(cluster.get());
+	cluster->start();
+	return cluster;
+}
+
+/**
+ * @brief 取出io_service_pool中的所有io_service,用于创建房间分片
+ * @param pool io_service池
+ * @return vector<io_service*>
+ */
+vector<boost::asio::io_service *> pool_services(io_service_pool &pool) {
+	vector<boost::asio::io_service *> services;
+	for (size_t i = 0; i < pool.size(); ++i)
+		services.push_back(&pool.get_io_service(i));
+	return services;
+}
+
+/**
+ * @brief 在第一个chat_server上打开配置的本机传输(Unix域socket/共享内存)
+ * @param server 第一个chat_server
+ * @param config 服务配置
+ * @return
+ */
+void listen_local_transports(chat_server &server, const server_config &config) {
+#ifdef CHAT_SERVER_HAS_SHM
+	if (!config.unix_path.empty())
+		server.listen_local(config.unix_path, false);
+	if (!config.shm_path.empty())
+		server.listen_local(config.shm_path, true);
+#else
+	if (!config.unix_path.empty() || !config.shm_path.empty())
+		cerr << "unix domain sockets are not supported on this platform" << endl;
+#endif
+}
+
+/**
+ * @brief 所有chat_server共享一个io_service,由server_num个线程一起run
+ * @param config 服务配置
+ * @return
+ */
+void run_shared(const server_config &config) {
+	boost::asio::io_service io_service;
+	//只有一个io_service时默认每个线程一个分片
+	room_registry rooms({ &io_service }, config.room_shards ? config.room_shards : config.server_num, config.room);
+	session_directory names;
+	auto cluster = start_cluster(io_service, rooms, config);
+	list<chat_server> servers;
+	for (int i = 0; i < config.server_num; ++i) {
+		tcp::endpoint endpoint(tcp::v4(), config.port);
+		servers.emplace_back(io_service, rooms, names, endpoint, i, false, config);
 	}
-	if (argc > 3) {
-		server_num = atoi(argv[2]);
+	listen_local_transports(servers.front(), config);
+	stats_reporter reporter(io_service, config.stats_interval);
+
+	vector<thread> thread_group;
+	for (int i = 0; i < config.server_num; ++i) {
+		thread_group.emplace_back([&io_service]() { io_service.run(); });
+	}
+
+	io_service.run();
+
+	for (auto &t : thread_group)
+		t.join();
+}
+
+/**
+ * @brief 每个核心一个io_service和一个SO_REUSEPORT的acceptor,
+ *        连接由内核分配到各个reactor,session整个生命周期都留在接受它的reactor上,
+ *        房间按id分片到各个reactor
+ * @param config 服务配置
+ * @return
+ */
+void run_per_core(const server_config &config) {
+	io_service_pool pool(config.reactor_num, config.pin_threads);
+	room_registry rooms(pool_services(pool), config.room_shards, config.room);
+	session_directory names;
+	auto cluster = start_cluster(pool.get_io_service(0), rooms, config);
+	list<chat_server> servers;
+	for (size_t i = 0; i < pool.size(); ++i) {
+		tcp::endpoint endpoint(tcp::v4(), config.port);
+		servers.emplace_back(pool.get_io_service(i), rooms, names, endpoint, int(i), true, config);
+	}
+	listen_local_transports(servers.front(), config);
+	stats_reporter reporter(pool.get_io_service(0), config.stats_interval);
+	pool.run();
+}
+
+/**
+ * @brief 每个reactor一个io_uring和一个SO_REUSEPORT的监听socket,
+ *        房间分片的strand仍运行在每核心的io_service上
+ * @param config 服务配置
+ * @return
+ */
+void run_uring(const server_config &config) {
+	io_service_pool pool(config.reactor_num, config.pin_threads);
+	room_registry rooms(pool_services(pool), config.room_shards, config.room);
+	session_directory names;
+	auto cluster = start_cluster(pool.get_io_service(0), rooms, config);
+	list<uring_server> servers;
+	for (size_t i = 0; i < pool.size(); ++i)
+		servers.emplace_back(rooms, names, config.port, int(i), config);
+	if (!config.unix_path.empty() || !config.shm_path.empty())
+		cerr << "--unix/--shm are served by the asio backend only, ignored with --io-uring" << endl;
+	if (config.codec.handshake())
+		cerr << "--codecs is served by the asio backend only, --io-uring clients always use protobuf" << endl;
+
+	vector<thread> thread_group;
+	for (auto &server : servers)
+		thread_group.emplace_back([&server]() { server.run(); });
+
+	stats_reporter reporter(pool.get_io_service(0), config.stats_interval);
+	pool.run();
+
+	for (auto &server : servers)
+		server.stop();
+	for (auto &t : thread_group)
+		t.join();
+}
+
+/**
+ * @brief 前端代理模式,每个reactor一个io_service,客户端连接轮流分配,本进程不承载房间
+ * @param config 服务配置
+ * @return
+ */
+void run_proxy(const server_config &config) {
+	io_service_pool pool(config.reactor_num, config.pin_threads);
+	chat_proxy proxy(pool_services(pool), config.port, config.proxy);
+	proxy.start();
+	cout << "proxy start on port " << config.port << endl;
+	stats_reporter reporter(pool.get_io_service(0), config.stats_interval);
+	pool.run();
+}
+
+int main(int argc, const char *const *argv) {
+	server_config config;
+	if (!parse_server_config(argc, argv, config)) {
+		print_server_usage(argv[0]);
+		return 1;
 	}
 
+	if (config.max_body_length > 0)
+		chat_message::set_max_body_length(config.max_body_length);
+
 	try {
 		GOOGLE_PROTOBUF_VERIFY_VERSION;
-		boost::asio::io_service io_service;
-		list<chat_server> servers;
-		for (int i = 0; i < server_num; ++i) {
-			tcp::endpoint endpoint(tcp::v4(), server_port);
-			servers.emplace_back(io_service, endpoint, i);
+		if (config.proxy.enabled()) {
+			run_proxy(config);
+			google::protobuf::ShutdownProtobufLibrary();
+			return 0;
 		}
-
-		vector<thread> thread_group;
-		for (int i = 0; i < server_num; ++i) {
-			thread_group.emplace_back([&io_service]() { io_service.run(); });
+		if (config.io_uring) {
+			if (uring_server::supported()) {
+				run_uring(config);
+				google::protobuf::ShutdownProtobufLibrary();
+				return 0;
+			}
+			cerr << "io_uring is not available, fall back to epoll" << endl;
+			config.per_core = true;
 		}
-
-		io_service.run();
-
-		for (auto &t : thread_group)
-			t.join();
+#ifdef SO_REUSEPORT
+		if (config.per_core)
+			run_per_core(config);
+		else
+			run_shared(config);
+#else
+		if (config.per_core)
+			cerr << "SO_REUSEPORT is not supported, fall back to shared io_service" << endl;
+		run_shared(config);
+#endif
 	}
 	catch (exception &e) {
 		cerr << "Exception: " << e.what() << endl;
@@ -378,4 +891,4 @@ int main(int argc, const char *const *argv) {
 
 	google::protobuf::ShutdownProtobufLibrary();
 	return 0;
-}
+}
\ No newline at end of file
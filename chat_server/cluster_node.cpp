@@ -0,0 +1,408 @@
+﻿#include "cluster_node.h"
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <unordered_set>
+#include "protocol.pb.h"
+#include "receive_buffer.h"
+#include "server_stats.h"
+
+using boost::asio::ip::tcp;
+
+/**
+ * @brief 与另一个节点之间的一条链路,两个方向都可以发送握手、订阅和转发
+ *        除构造外的所有成员只在cluster_node的strand中访问
+ */
+class cluster_node::link : public std::enable_shared_from_this<cluster_node::link> {
+public:
+	enum : size_t { inbound = size_t(-1) };
+
+	/**
+	 * @brief 构造
+	 * @param node 所属节点
+	 * @param socket 已连接的socket
+	 * @param peer_index 主动连接时是peer的下标,被动接受时为inbound
+	 * @return 本类对象
+	 */
+	link(cluster_node &node, tcp::socket socket, size_t peer_index)
+		: peer_index(peer_index), node_(node), socket_(std::move(socket)) {
+		boost::system::error_code ec;
+		socket_.set_option(tcp::no_delay(true), ec);
+	}
+
+	bool dialed() const {
+		return peer_index != inbound;
+	}
+
+	/**
+	 * @brief 开始读取
+	 * @param
+	 * @return
+	 */
+	void start() {
+		do_read();
+	}
+
+	/**
+	 * @brief 发送一条消息,发送队列超过上限时断开链路
+	 * @param msg 编码好的共享消息帧
+	 * @return
+	 */
+	void send(const chat_message_ptr &msg) {
+		if (closed_)
+			return;
+		queue_.push_back(msg);
+		queued_bytes_ += msg->length();
+		if (queued_bytes_ > node_.options_.max_queue_bytes) {
+			std::cerr << "cluster: link to node " << remote_id << " is too slow, disconnecting" << std::endl;
+			close();
+			return;
+		}
+		if (write_buffers_.empty())
+			do_write();
+	}
+
+	/**
+	 * @brief 关闭链路并通知节点,可重复调用
+	 * @param
+	 * @return
+	 */
+	void close() {
+		if (closed_)
+			return;
+		closed_ = true;
+		boost::system::error_code ec;
+		socket_.close(ec);
+		node_.on_closed(shared_from_this());
+	}
+
+	//对端节点的id,收到握手前为0
+	uint64_t remote_id = 0;
+	size_t peer_index;
+	//被去重关闭的链路不重连
+	bool duplicate = false;
+	//对端订阅的房间
+	std::unordered_set<uint64_t> rooms;
+
+private:
+	void do_read() {
+		auto self(shared_from_this());
+		socket_.async_read_some(
+			boost::asio::buffer(read_buffer_.write_data(), read_buffer_.write_size()),
+			node_.strand_.wrap([this, self](boost::system::error_code ec, size_t length) {
+				if (ec || closed_) {
+					close();
+					return;
+				}
+				read_buffer_.commit(length);
+				bool ok = true;
+				auto frames = parse_frames(read_buffer_, [this, &ok](int type, const char *body, size_t body_length) {
+					if (ok && !closed_)
+						ok = node_.on_message(shared_from_this(), type, body, body_length);
+				});
+				if (frames < 0 || !ok) {
+					close();
+					return;
+				}
+				if (!closed_)
+					do_read();
+			}));
+	}
+
+	void do_write() {
+		write_buffers_.clear();
+		for (const auto &msg : queue_) {
+			if (write_buffers_.size() >= max_write_batch_msgs)
+				break;
+			write_buffers_.push_back(boost::asio::buffer(msg->data(), msg->length()));
+		}
+		auto self(shared_from_this());
+		boost::asio::async_write(socket_, write_buffers_,
+			node_.strand_.wrap([this, self](boost::system::error_code ec, size_t) {
+				if (ec) {
+					write_buffers_.clear();
+					close();
+					return;
+				}
+				for (size_t i = 0; i < write_buffers_.size(); ++i) {
+					queued_bytes_ -= queue_.front()->length();
+					queue_.pop_front();
+				}
+				write_buffers_.clear();
+				if (!queue_.empty() && !closed_)
+					do_write();
+			}));
+	}
+
+private:
+	enum { max_write_batch_msgs = 64 };
+
+	cluster_node &node_;
+	tcp::socket socket_;
+	receive_buffer read_buffer_;
+	std::deque<chat_message_ptr> queue_;
+	size_t queued_bytes_ = 0;
+	//正在发送中的消息对应的buffer,为空表示没有进行中的写
+	std::vector<boost::asio::const_buffer> write_buffers_;
+	bool closed_ = false;
+};
+
+/**
+ * @brief 构造
+ * @param io_service 链路所在的io_service
+ * @param options 集群参数
+ * @param handler 收到转发的广播时的回调
+ * @return 本类对象
+ */
+cluster_node::cluster_node(boost::asio::io_service &io_service, const cluster_options &options, relay_handler handler)
+	: io_service_(io_service), strand_(io_service), options_(options),
+	  node_id_(options.node_id),
+	  handler_(std::move(handler)), accept_socket_(io_service) {
+}
+
+cluster_node::~cluster_node() {
+}
+
+/**
+ * @brief 开始监听并连接所有peers
+ * @param
+ * @return
+ */
+void cluster_node::start() {
+	if (options_.node_port > 0) {
+		acceptor_.reset(new tcp::acceptor(io_service_, tcp::endpoint(tcp::v4(), options_.node_port)));
+		do_accept();
+	}
+	std::cout << "cluster node " << node_id_ << " start, " << options_.peers.size() << " peers" << std::endl;
+	for (size_t i = 0; i < options_.peers.size(); ++i)
+		dial(i);
+}
+
+/**
+ * @brief 本地房间有了成员,通知所有节点把该房间的广播转发过来
+ * @param room_id 房间id
+ * @return
+ */
+void cluster_node::subscribe(uint64_t room_id) {
+	strand_.post([this, room_id] {
+		if (!local_rooms_.insert(room_id).second)
+			return;
+		auto msg = rooms_message(MT_NODE_SUBSCRIBE, { room_id });
+		for (const auto &l : links_)
+			l->send(msg);
+	});
+}
+
+/**
+ * @brief 本地房间已回收,通知所有节点停止转发
+ * @param room_id 房间id
+ * @return
+ */
+void cluster_node::unsubscribe(uint64_t room_id) {
+	strand_.post([this, room_id] {
+		if (!local_rooms_.erase(room_id))
+			return;
+		auto msg = rooms_message(MT_NODE_UNSUBSCRIBE, { room_id });
+		for (const auto &l : links_)
+			l->send(msg);
+	});
+}
+
+/**
+ * @brief 把本地客户端的房间广播转发给订阅了该房间的节点,消息帧在调用时编码,之后可以修改
+ * @param room_id 房间id
+ * @param msg 客户端消息帧
+ * @return
+ */
+void cluster_node::relay(uint64_t room_id, const chat_message &msg) {
+	PNodeRelay relay;
+	relay.set_room_id(room_id);
+	relay.set_type(msg.type());
+	relay.set_body(msg.body(), msg.body_length());
+	if (relay.ByteSizeLong() > chat_message::max_body_length())
+		return;
+	//每条广播只编码一次,所有订阅的链路共享同一帧
+	auto frame = std::make_shared<chat_message>();
+	frame->set_message(MT_NODE_RELAY, relay.SerializeAsString());
+	chat_message_ptr shared_frame(std::move(frame));
+	strand_.post([this, room_id, shared_frame] {
+		size_t links = 0;
+		for (const auto &l : links_) {
+			if (l->remote_id != 0 && l->rooms.count(room_id)) {
+				l->send(shared_frame);
+				++links;
+			}
+		}
+		server_stats::instance().record_node_relay(false, links);
+	});
+}
+
+/**
+ * @brief 接受其他节点的连接
+ * @param
+ * @return
+ */
+void cluster_node::do_accept() {
+	acceptor_->async_accept(accept_socket_, strand_.wrap([this](boost::system::error_code ec) {
+		if (!ec) {
+			auto l = std::make_shared<link>(*this, std::move(accept_socket_), link::inbound);
+			on_connected(l);
+		}
+		do_accept();
+	}));
+}
+
+/**
+ * @brief 连接一个peer,失败或断开后定时重连
+ * @param index peer在options_.peers中的下标
+ * @return
+ */
+void cluster_node::dial(size_t index) {
+	const auto &peer = options_.peers[index];
+	auto colon = peer.rfind(':');
+	auto resolver = std::make_shared<tcp::resolver>(io_service_);
+	auto socket = std::make_shared<tcp::socket>(io_service_);
+	auto retry = [this, index] {
+		auto timer = std::make_shared<boost::asio::steady_timer>(io_service_);
+		timer->expires_from_now(std::chrono::milliseconds(options_.reconnect_ms));
+		timer->async_wait(strand_.wrap([this, index, timer](boost::system::error_code) {
+			dial(index);
+		}));
+	};
+	resolver->async_resolve(tcp::resolver::query(peer.substr(0, colon), peer.substr(colon + 1)),
+		strand_.wrap([this, index, resolver, socket, retry](boost::system::error_code ec, tcp::resolver::iterator it) {
+			if (ec) {
+				retry();
+				return;
+			}
+			boost::asio::async_connect(*socket, it,
+				strand_.wrap([this, index, socket, retry](boost::system::error_code ec, tcp::resolver::iterator) {
+					if (ec) {
+						retry();
+						return;
+					}
+					on_connected(std::make_shared<link>(*this, std::move(*socket), index));
+				}));
+		}));
+}
+
+/**
+ * @brief 链路建立,发送握手和本节点订阅的全部房间,只在strand_中调用
+ * @param l 链路
+ * @return
+ */
+void cluster_node::on_connected(const link_ptr &l) {
+	links_.insert(l);
+	PNodeHello hello;
+	hello.set_node_id(node_id_);
+	auto msg = std::make_shared<chat_message>();
+	msg->set_message(MT_NODE_HELLO, hello.SerializeAsString());
+	l->send(chat_message_ptr(std::move(msg)));
+	if (!local_rooms_.empty())
+		l->send(rooms_message(MT_NODE_SUBSCRIBE, std::vector<uint64_t>(local_rooms_.begin(), local_rooms_.end())));
+	l->start();
+}
+
+/**
+ * @brief 处理链路上收到的一条消息,只在strand_中调用
+ * @param l 链路
+ * @param type 消息类型
+ * @param body 消息体
+ * @param body_length 消息体长度
+ * @return bool false表示应断开链路
+ */
+bool cluster_node::on_message(const link_ptr &l, int type, const char *body, size_t body_length) {
+	if (type == MT_NODE_HELLO) {
+		PNodeHello hello;
+		if (!hello.ParseFromArray(body, int(body_length)) || hello.node_id() == 0 || l->remote_id != 0)
+			return false;
+		if (hello.node_id() == node_id_) {
+			//连到了自己或另一个节点用了相同的id,都是配置错误,断开后照常重连,直到修正
+			std::cout << "cluster: peer " << (l->dialed() ? options_.peers[l->peer_index] : std::string("(accepted)"))
+					  << " reports our own node id " << node_id_ << ", check --node-id/--peers" << std::endl;
+			return false;
+		}
+		l->remote_id = hello.node_id();
+		//两个节点互相连接时,双方都保留由id较小的节点发起的链路;同一方发起的保留较新的一条
+		auto dialer = [this](const link_ptr &x) {
+			return x->dialed() ? node_id_ : x->remote_id;
+		};
+		std::vector<link_ptr> stale;
+		for (const auto &other : links_) {
+			if (other == l || other->remote_id != l->remote_id)
+				continue;
+			if (dialer(l) > dialer(other)) {
+				l->duplicate = true;
+				return false;
+			}
+			stale.push_back(other);
+		}
+		for (const auto &other : stale) {
+			other->duplicate = true;
+			other->close();
+		}
+		std::cout << "cluster: linked to node " << l->remote_id << (l->dialed() ? " (dialed)" : " (accepted)") << std::endl;
+		return true;
+	}
+	if (l->remote_id == 0)
+		return false;
+
+	if (type == MT_NODE_SUBSCRIBE || type == MT_NODE_UNSUBSCRIBE) {
+		PNodeRooms rooms;
+		if (!rooms.ParseFromArray(body, int(body_length)))
+			return false;
+		for (auto room_id : rooms.room_ids()) {
+			if (type == MT_NODE_SUBSCRIBE)
+				l->rooms.insert(room_id);
+			else
+				l->rooms.erase(room_id);
+		}
+		return true;
+	}
+	if (type == MT_NODE_RELAY) {
+		PNodeRelay relay;
+		if (!relay.ParseFromArray(body, int(body_length)) || relay.body().size() > chat_message::max_body_length())
+			return false;
+		auto msg = std::make_shared<chat_message>();
+		msg->set_message(relay.type(), relay.body());
+		server_stats::instance().record_node_relay(true, 1);
+		handler_(relay.room_id(), msg);
+		return true;
+	}
+	return false;
+}
+
+/**
+ * @brief 链路断开,主动连接的链路定时重连,只在strand_中调用
+ * @param l 链路
+ * @return
+ */
+void cluster_node::on_closed(const link_ptr &l) {
+	if (!links_.erase(l))
+		return;
+	if (l->remote_id != 0 && !l->duplicate)
+		std::cout << "cluster: lost node " << l->remote_id << std::endl;
+	if (!l->dialed() || l->duplicate)
+		return;
+	auto timer = std::make_shared<boost::asio::steady_timer>(io_service_);
+	timer->expires_from_now(std::chrono::milliseconds(options_.reconnect_ms));
+	auto index = l->peer_index;
+	timer->async_wait(strand_.wrap([this, index, timer](boost::system::error_code) {
+		dial(index);
+	}));
+}
+
+/**
+ * @brief 编码一条房间列表消息
+ * @param type MT_NODE_SUBSCRIBE或MT_NODE_UNSUBSCRIBE
+ * @param rooms 房间id
+ * @return chat_message_ptr
+ */
+chat_message_ptr cluster_node::rooms_message(int type, const std::vector<uint64_t> &rooms) {
+	PNodeRooms message;
+	for (auto room_id : rooms)
+		message.add_room_ids(room_id);
+	auto msg = std::make_shared<chat_message>();
+	msg->set_message(type, message.SerializeAsString());
+	return msg;
+}
@@ -0,0 +1,154 @@
+﻿#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include "chat_history.h"
+
+/**
+ * @brief 集群参数
+ */
+struct cluster_options {
+	//本节点的id,集群内唯一,启用集群时必须设置
+	uint64_t node_id = 0;
+	//节点链路的监听端口,0表示不监听,只主动连接peers
+	int node_port = 0;
+	//其他节点的链路地址,"host:port"
+	std::vector<std::string> peers;
+	//链路断开后重连的间隔(毫秒)
+	int reconnect_ms = 1000;
+	//每条链路发送队列的字节上限,超出时断开链路,重连后重新订阅
+	size_t max_queue_bytes = 64 * 1024 * 1024;
+
+	bool enabled() const {
+		return node_port > 0 || !peers.empty();
+	}
+};
+
+/**
+ * @brief 集群中的一个节点,与其他每个节点保持一条双向的TCP链路
+ *        节点把本地有成员的房间订阅到每条链路上,房间广播只发给订阅了该房间的节点,
+ *        每条消息每个节点只跨一次网络,由对端节点在本地房间中扇出给自己的成员
+ *        转发的消息不再转发,集群是全连接的,不会形成环路
+ *        两个节点互相连接时各自按同一规则只保留由id较小的节点发起的那条链路
+ *        所有链路状态只在内部的strand中访问,subscribe/unsubscribe/relay可在任意线程调用
+ */
+class cluster_node {
+public:
+	/**
+	 * @brief 收到其他节点转发的房间广播时的回调,在strand中调用
+	 */
+	using relay_handler = std::function<void(uint64_t room_id, const std::shared_ptr<chat_message> &msg)>;
+
+	/**
+	 * @brief 构造
+	 * @param io_service 链路所在的io_service
+	 * @param options 集群参数
+	 * @param handler 收到转发的广播时的回调
+	 * @return 本类对象
+	 */
+	cluster_node(boost::asio::io_service &io_service, const cluster_options &options, relay_handler handler);
+	~cluster_node();
+
+	cluster_node(const cluster_node &) = delete;
+	cluster_node &operator=(const cluster_node &) = delete;
+
+	/**
+	 * @brief 开始监听并连接所有peers
+	 * @param
+	 * @return
+	 */
+	void start();
+
+	/**
+	 * @brief 本地房间有了成员,通知所有节点把该房间的广播转发过来
+	 * @param room_id 房间id
+	 * @return
+	 */
+	void subscribe(uint64_t room_id);
+
+	/**
+	 * @brief 本地房间已回收,通知所有节点停止转发
+	 * @param room_id 房间id
+	 * @return
+	 */
+	void unsubscribe(uint64_t room_id);
+
+	/**
+	 * @brief 把本地客户端的房间广播转发给订阅了该房间的节点,消息帧在调用时编码,之后可以修改
+	 * @param room_id 房间id
+	 * @param msg 客户端消息帧
+	 * @return
+	 */
+	void relay(uint64_t room_id, const chat_message &msg);
+
+	uint64_t id() const {
+		return node_id_;
+	}
+
+private:
+	class link;
+	using link_ptr = std::shared_ptr<link>;
+
+	/**
+	 * @brief 接受其他节点的连接
+	 * @param
+	 * @return
+	 */
+	void do_accept();
+
+	/**
+	 * @brief 连接一个peer,失败或断开后定时重连
+	 * @param index peer在options_.peers中的下标
+	 * @return
+	 */
+	void dial(size_t index);
+
+	/**
+	 * @brief 链路建立,发送握手和本节点订阅的全部房间,只在strand_中调用
+	 * @param l 链路
+	 * @return
+	 */
+	void on_connected(const link_ptr &l);
+
+	/**
+	 * @brief 处理链路上收到的一条消息,只在strand_中调用
+	 * @param l 链路
+	 * @param type 消息类型
+	 * @param body 消息体
+	 * @param body_length 消息体长度
+	 * @return bool false表示应断开链路
+	 */
+	bool on_message(const link_ptr &l, int type, const char *body, size_t body_length);
+
+	/**
+	 * @brief 链路断开,主动连接的链路定时重连,只在strand_中调用
+	 * @param l 链路
+	 * @return
+	 */
+	void on_closed(const link_ptr &l);
+
+	/**
+	 * @brief 编码一条房间列表消息
+	 * @param type MT_NODE_SUBSCRIBE或MT_NODE_UNSUBSCRIBE
+	 * @param rooms 房间id
+	 * @return chat_message_ptr
+	 */
+	static chat_message_ptr rooms_message(int type, const std::vector<uint64_t> &rooms);
+
+private:
+	boost::asio::io_service &io_service_;
+	boost::asio::io_service::strand strand_;
+	cluster_options options_;
+	uint64_t node_id_;
+	relay_handler handler_;
+	std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor_;
+	boost::asio::ip::tcp::socket accept_socket_;
+	//所有已连接的链路,包括尚未完成握手的
+	std::set<link_ptr> links_;
+	//本节点有成员的房间,链路建立时整体发给对端
+	std::set<uint64_t> local_rooms_;
+};
@@ -0,0 +1,216 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/**
+ * @brief flat编码的消息体: 定长的字段槽加按偏移引用的字符串,读取方直接在收到的消息体上访问字段,
+ *        不反序列化也不分配内存;所有整数都是小端
+ *          [0]                   uint8  magic,固定为'F'
+ *          [1]                   uint8  version,只有不兼容的改动才增加,版本不同的消息体整个拒绝
+ *          [2, 4)                uint16 field_count,字段槽的个数
+ *          [4, 4 + 8*field_count) 字段槽,每个8字节: 整数字段是uint64的值,
+ *                                字符串字段是uint32的偏移(相对消息体起点)加uint32的长度
+ *          之后                  字符串数据
+ *        兼容的扩展只能在末尾追加字段: 读取方把超出field_count的字段当作0或空串,忽略多出来的字段
+ */
+enum {
+	flat_magic = 'F',
+	flat_version = 1,
+	flat_header_length = 4,
+	flat_slot_length = 8,
+};
+
+//各消息类型的字段,下标即字段槽的序号
+//MT_BIND_NAME
+struct flat_bind_name {
+	enum { name, field_count };
+};
+
+//MT_CHAT_INFO和MT_ROOM_CHAT,大厅聊天的room_id不填
+struct flat_chat {
+	enum { information, room_id, field_count };
+};
+
+//MT_JOIN_ROOM和MT_LEAVE_ROOM,离开房间的last_seq不填
+struct flat_join_room {
+	enum { room_id, last_seq, field_count };
+};
+
+//MT_DIRECT_CHAT
+struct flat_direct_chat {
+	enum { to, information, field_count };
+};
+
+//MT_ROOM_INFO和MT_DIRECT_INFO,私聊的room_id和seq为0
+struct flat_room_info {
+	enum { name, information, room_id, seq, field_count };
+};
+
+//MT_RESYNC_TOO_FAR
+struct flat_resync_too_far {
+	enum { room_id, last_seq, first_seq, field_count };
+};
+
+/**
+ * @brief 在消息体上按字段读取,构造时只检查头部,每次读取字符串都检查偏移和长度不越界
+ */
+class flat_reader {
+public:
+	flat_reader(const char *body, size_t body_length)
+		: body_(reinterpret_cast<const uint8_t *>(body)), body_length_(body_length) {
+		if (body_length_ < flat_header_length || body_[0] != flat_magic || body_[1] != flat_version)
+			return;
+		size_t field_count = size_t(body_[2]) | size_t(body_[3]) << 8;
+		if (field_count > (body_length_ - flat_header_length) / flat_slot_length)
+			return;
+		field_count_ = field_count;
+		valid_ = true;
+	}
+
+	/**
+	 * @brief 头部是否合法: magic和版本匹配,字段槽没有超出消息体
+	 * @param
+	 * @return bool
+	 */
+	bool valid() const {
+		return valid_;
+	}
+
+	size_t field_count() const {
+		return field_count_;
+	}
+
+	/**
+	 * @brief 读取整数字段
+	 * @param field 字段序号
+	 * @return uint64_t 字段不存在时为0
+	 */
+	uint64_t uint_field(size_t field) const {
+		if (field >= field_count_)
+			return 0;
+		return load_le(slot(field), 8);
+	}
+
+	/**
+	 * @brief 读取字符串字段,返回的指针指向消息体内部
+	 * @param field 字段序号
+	 * @param data 输出字符串的起点,字段不存在时为nullptr
+	 * @param size 输出字符串的长度,字段不存在时为0
+	 * @return bool 字段不存在时返回true,偏移或长度越界时返回false
+	 */
+	bool string_field(size_t field, const char *&data, size_t &size) const {
+		data = nullptr;
+		size = 0;
+		if (field >= field_count_)
+			return true;
+		const uint8_t *s = slot(field);
+		uint64_t offset = load_le(s, 4);
+		uint64_t length = load_le(s + 4, 4);
+		//字符串只能位于字段槽之后,不能与头部和字段槽重叠
+		if (offset < flat_header_length + field_count_ * flat_slot_length ||
+			offset > body_length_ || length > body_length_ - offset)
+			return false;
+		data = reinterpret_cast<const char *>(body_) + offset;
+		size = size_t(length);
+		return true;
+	}
+
+	bool string_field(size_t field, std::string &value) const {
+		const char *data;
+		size_t size;
+		if (!string_field(field, data, size))
+			return false;
+		value.assign(data ? data : "", size);
+		return true;
+	}
+
+private:
+	const uint8_t *slot(size_t field) const {
+		return body_ + flat_header_length + field * flat_slot_length;
+	}
+
+	static uint64_t load_le(const uint8_t *p, int bytes) {
+		uint64_t value = 0;
+		for (int i = bytes - 1; i >= 0; --i)
+			value = value << 8 | p[i];
+		return value;
+	}
+
+private:
+	const uint8_t *body_;
+	size_t body_length_;
+	size_t field_count_ = 0;
+	bool valid_ = false;
+};
+
+/**
+ * @brief 在调用方准备好的内存上写一个flat消息体,字符串按set_string的顺序依次追加在字段槽之后,
+ *        未设置的字段为0或空串
+ */
+class flat_builder {
+public:
+	/**
+	 * @brief 消息体的字节数
+	 * @param field_count 字段个数
+	 * @param string_bytes 所有字符串字段的总字节数
+	 * @return size_t
+	 */
+	static size_t body_size(size_t field_count, size_t string_bytes) {
+		return flat_header_length + field_count * flat_slot_length + string_bytes;
+	}
+
+	/**
+	 * @brief 构造并写入头部,字段槽清零
+	 * @param body 至少body_size(field_count, 所有字符串的字节数)字节的内存
+	 * @param field_count 字段个数
+	 * @return 本类对象
+	 */
+	flat_builder(char *body, size_t field_count)
+		: body_(reinterpret_cast<uint8_t *>(body)), end_(flat_header_length + field_count * flat_slot_length) {
+		body_[0] = flat_magic;
+		body_[1] = flat_version;
+		store_le(body_ + 2, field_count, 2);
+		memset(body_ + flat_header_length, 0, field_count * flat_slot_length);
+	}
+
+	void set_uint(size_t field, uint64_t value) {
+		store_le(slot(field), value, 8);
+	}
+
+	void set_string(size_t field, const char *data, size_t size) {
+		uint8_t *s = slot(field);
+		store_le(s, end_, 4);
+		store_le(s + 4, size, 4);
+		if (size)
+			memcpy(body_ + end_, data, size);
+		end_ += size;
+	}
+
+	void set_string(size_t field, const std::string &value) {
+		set_string(field, value.data(), value.size());
+	}
+
+	/**
+	 * @brief 已写入的字节数
+	 * @param
+	 * @return size_t
+	 */
+	size_t size() const {
+		return end_;
+	}
+
+private:
+	uint8_t *slot(size_t field) {
+		return body_ + flat_header_length + field * flat_slot_length;
+	}
+
+	static void store_le(uint8_t *p, uint64_t value, int bytes) {
+		for (int i = 0; i < bytes; ++i, value >>= 8)
+			p[i] = uint8_t(value);
+	}
+
+private:
+	uint8_t *body_;
+	size_t end_;
+};
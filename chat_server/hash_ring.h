@@ -0,0 +1,92 @@
+﻿#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/asio.hpp>
+
+/**
+ * @brief 房间到后端的一致性哈希环,每个后端在环上放virtual_nodes个虚拟节点,
+ *        房间id的哈希顺时针遇到的第一个虚拟节点所属的后端即房间的所有者
+ *        增删一个后端时只有落在它的区间内的房间改变所有者
+ *        构造后不再修改,由代理整体替换并以shared_ptr发布
+ */
+class hash_ring {
+public:
+	/**
+	 * @brief 一个后端
+	 */
+	struct node {
+		//配置中的地址"host:port",也是虚拟节点哈希的输入
+		std::string name;
+		boost::asio::ip::tcp::endpoint endpoint;
+	};
+
+	/**
+	 * @brief 构造
+	 * @param nodes 后端
+	 * @param virtual_nodes 每个后端的虚拟节点数
+	 * @return 本类对象
+	 */
+	hash_ring(std::vector<node> nodes, int virtual_nodes)
+		: nodes_(std::move(nodes)) {
+		points_.reserve(nodes_.size() * size_t(virtual_nodes));
+		for (size_t i = 0; i < nodes_.size(); ++i) {
+			for (int v = 0; v < virtual_nodes; ++v) {
+				std::string key = nodes_[i].name + "#" + std::to_string(v);
+				points_.emplace_back(mix(fnv1a(key.data(), key.size())), uint32_t(i));
+			}
+		}
+		std::sort(points_.begin(), points_.end());
+	}
+
+	/**
+	 * @brief 房间的所有者
+	 * @param room_id 房间id
+	 * @return const node* 环为空时返回nullptr
+	 */
+	const node *owner(uint64_t room_id) const {
+		if (points_.empty())
+			return nullptr;
+		auto h = mix(room_id);
+		auto it = std::lower_bound(points_.begin(), points_.end(), std::make_pair(h, uint32_t(0)));
+		if (it == points_.end())
+			it = points_.begin();
+		return &nodes_[it->second];
+	}
+
+	const std::vector<node> &nodes() const {
+		return nodes_;
+	}
+
+	bool empty() const {
+		return nodes_.empty();
+	}
+
+private:
+	static uint64_t fnv1a(const char *data, size_t size) {
+		uint64_t h = 0xcbf29ce484222325ull;
+		for (size_t i = 0; i < size; ++i) {
+			h ^= static_cast<unsigned char>(data[i]);
+			h *= 0x100000001b3ull;
+		}
+		return h;
+	}
+
+	//splitmix64的终结函数,连续的房间id也能均匀地落在环上
+	static uint64_t mix(uint64_t x) {
+		x += 0x9E3779B97F4A7C15ull;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+		return x ^ (x >> 31);
+	}
+
+private:
+	std::vector<node> nodes_;
+	//按哈希排序的虚拟节点(哈希,后端下标)
+	std::vector<std::pair<uint64_t, uint32_t>> points_;
+};
+
+using hash_ring_ptr = std::shared_ptr<const hash_ring>;
@@ -0,0 +1,112 @@
+﻿#pragma once
+#include <memory>
+#include <vector>
+#include <thread>
+#include <boost/asio.hpp>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @brief 每个核心一个io_service,每个io_service只由一个线程驱动
+ *        同一个io_service上的所有handler都在同一个线程里执行,不再争用同一把队列锁
+ */
+class io_service_pool {
+public:
+	/**
+	 * @brief 构造
+	 * @param pool_size io_service个数,0表示使用cpu核心数
+	 * @param pin_threads 是否将第i个线程绑定到第i个cpu
+	 * @return 本类对象
+	 */
+	explicit io_service_pool(size_t pool_size, bool pin_threads = true)
+		: pin_threads_(pin_threads) {
+		if (pool_size == 0)
+			pool_size = hardware_concurrency();
+		for (size_t i = 0; i < pool_size; ++i) {
+			auto io_service = std::make_shared<boost::asio::io_service>(1);
+			io_services_.push_back(io_service);
+			works_.emplace_back(new boost::asio::io_service::work(*io_service));
+		}
+	}
+
+	io_service_pool(const io_service_pool &) = delete;
+	io_service_pool &operator=(const io_service_pool &) = delete;
+
+	/**
+	 * @brief 为每个io_service启动一个线程并等待所有线程退出
+	 * @param
+	 * @return
+	 */
+	void run() {
+		std::vector<std::thread> threads;
+		size_t cpus = hardware_concurrency();
+		for (size_t i = 0; i < io_services_.size(); ++i) {
+			auto io_service = io_services_[i];
+			bool pin = pin_threads_;
+			threads.emplace_back([io_service, pin, i, cpus]() {
+				if (pin)
+					pin_current_thread(i % cpus);
+				io_service->run();
+			});
+		}
+		for (auto &t : threads)
+			t.join();
+	}
+
+	/**
+	 * @brief 停止所有io_service
+	 * @param
+	 * @return
+	 */
+	void stop() {
+		works_.clear();
+		for (auto &io_service : io_services_)
+			io_service->stop();
+	}
+
+	/**
+	 * @brief 获取第index个io_service
+	 * @param index 下标
+	 * @return io_service引用
+	 */
+	boost::asio::io_service &get_io_service(size_t index) {
+		return *io_services_[index % io_services_.size()];
+	}
+
+	size_t size() const {
+		return io_services_.size();
+	}
+
+private:
+	static size_t hardware_concurrency() {
+		auto n = std::thread::hardware_concurrency();
+		return n == 0 ? 1 : n;
+	}
+
+	/**
+	 * @brief 将当前线程绑定到指定cpu,失败时忽略
+	 * @param cpu cpu序号
+	 * @return
+	 */
+	static void pin_current_thread(size_t cpu) {
+#ifdef _WIN32
+		SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+#elif defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+		(void)cpu;
+#endif
+	}
+
+private:
+	bool pin_threads_;
+	std::vector<std::shared_ptr<boost::asio::io_service>> io_services_;
+	std::vector<std::unique_ptr<boost::asio::io_service::work>> works_;
+};
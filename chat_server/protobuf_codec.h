@@ -0,0 +1,286 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
+#include "chat_message.h"
+#include "protocol.pb.h"
+
+/**
+ * @brief 每个线程一个protobuf Arena,处理一条客户端消息时解码和编码用到的protobuf对象都在其上创建,
+ *        初始块是线程第一次使用时分配的一块内存,消息处理完后整体reset,
+ *        字段内容不超过初始块时处理一条消息没有堆分配,超出部分在reset时归还
+ */
+class message_arena {
+public:
+	enum { initial_block_size = 64 * 1024 };
+
+	/**
+	 * @brief 一条消息的处理范围,最外层的scope析构时reset本线程的Arena,
+	 *        在scope之外不能持有Arena上创建的对象
+	 */
+	class scope {
+	public:
+		scope() {
+			++local().depth;
+		}
+
+		~scope() {
+			auto &l = local();
+			if (--l.depth == 0)
+				l.arena.Reset();
+		}
+
+		scope(const scope &) = delete;
+		scope &operator=(const scope &) = delete;
+	};
+
+	/**
+	 * @brief 在本线程的Arena上创建一个protobuf消息,对象随Arena的reset一起释放,不需要delete
+	 * @param
+	 * @return T*
+	 */
+	template <typename T>
+	static T *create() {
+		return google::protobuf::Arena::CreateMessage<T>(&local().arena);
+	}
+
+private:
+	struct thread_arena {
+		thread_arena()
+			: block(new char[initial_block_size]), arena(make_options(block.get())) {
+		}
+
+		static google::protobuf::ArenaOptions make_options(char *block) {
+			google::protobuf::ArenaOptions options;
+			options.initial_block = block;
+			options.initial_block_size = initial_block_size;
+			return options;
+		}
+
+		//block必须先于arena构造、后于arena析构
+		std::unique_ptr<char[]> block;
+		google::protobuf::Arena arena;
+		int depth = 0;
+	};
+
+	static thread_arena &local() {
+		thread_local thread_arena arena;
+		return arena;
+	}
+};
+
+/**
+ * @brief 直接从消息体解码protobuf,通过零拷贝输入流读取,不先复制成std::string
+ * @param msg 输出的protobuf消息
+ * @param body 消息体
+ * @param body_length 消息体长度
+ * @return bool 是否解码成功
+ */
+inline bool parse_protobuf(google::protobuf::MessageLite *msg, const char *body, size_t body_length) {
+	google::protobuf::io::ArrayInputStream input(body, int(body_length));
+	return msg->ParseFromZeroCopyStream(&input);
+}
+
+/**
+ * @brief 在本线程的Arena上创建并解码一个protobuf消息,需在message_arena::scope之内调用
+ * @param body 消息体
+ * @param body_length 消息体长度
+ * @return T* 解码失败时返回nullptr
+ */
+template <typename T>
+T *parse_on_arena(const char *body, size_t body_length) {
+	T *msg = message_arena::create<T>();
+	return parse_protobuf(msg, body, body_length) ? msg : nullptr;
+}
+
+/**
+ * @brief 把protobuf消息直接序列化进消息帧的消息体,不经过中间的std::string
+ * @param msg protobuf消息
+ * @param type 消息类型
+ * @param out 输出的消息帧
+ * @return bool 序列化后超过消息体上限时返回false
+ */
+inline bool serialize_protobuf(const google::protobuf::MessageLite &msg, int type, chat_message &out) {
+	size_t size = msg.ByteSizeLong();
+	if (size > chat_message::max_body_length())
+		return false;
+	msg.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(out.prepare_message(type, size)));
+	return true;
+}
+
+/**
+ * @brief 编码后的一个字符串字段(tag+长度+内容)的字节数
+ * @param field 字段号
+ * @param size 内容的字节数
+ * @return size_t
+ */
+inline size_t string_field_size(int field, size_t size) {
+	using google::protobuf::io::CodedOutputStream;
+	using google::protobuf::internal::WireFormatLite;
+	return CodedOutputStream::VarintSize32(WireFormatLite::MakeTag(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED)) +
+		   CodedOutputStream::VarintSize32(uint32_t(size)) + size;
+}
+
+/**
+ * @brief 把一个字符串字段按protobuf的线格式写到target,调用者保证空间足够
+ * @param field 字段号
+ * @param data 内容
+ * @param size 内容的字节数
+ * @param target 输出位置
+ * @return uint8_t* 写入后的位置
+ */
+inline uint8_t *write_string_field(int field, const char *data, size_t size, uint8_t *target) {
+	using google::protobuf::io::CodedOutputStream;
+	using google::protobuf::internal::WireFormatLite;
+	target = WireFormatLite::WriteTagToArray(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, target);
+	target = CodedOutputStream::WriteVarint32ToArray(uint32_t(size), target);
+	memcpy(target, data, size);
+	return target + size;
+}
+
+/**
+ * @brief 预先编码一个字符串字段,内容为空时与protobuf一样省略该字段,返回空串
+ * @param field 字段号
+ * @param value 内容
+ * @return std::string 编码好的字段
+ */
+inline std::string encode_string_field(int field, const std::string &value) {
+	std::string encoded;
+	if (value.empty())
+		return encoded;
+	encoded.resize(string_field_size(field, value.size()));
+	write_string_field(field, value.data(), value.size(), reinterpret_cast<uint8_t *>(&encoded[0]));
+	return encoded;
+}
+
+/**
+ * @brief 名字和聊天内容是否为合法的UTF-8,它们最终会被编码进protobuf帧的string字段,
+ *        所有编码的解码都要在交给chat_handler之前检查,否则收到该帧的客户端解析失败
+ * @param data 字符串
+ * @param size 字节数
+ * @return bool 空串合法
+ */
+inline bool valid_utf8(const char *data, size_t size) {
+	return !size || google::protobuf::internal::IsStructurallyValidUTF8(data, int(size));
+}
+
+inline bool valid_utf8(const std::string &value) {
+	return valid_utf8(value.data(), value.size());
+}
+
+/**
+ * @brief 不构造消息对象,直接在聊天消息体中定位聊天内容和房间id,
+ *        与protobuf的解析一样同一字段出现多次时取最后一次,未知字段跳过,内容必须是合法的UTF-8
+ * @param body 消息体
+ * @param body_length 消息体长度
+ * @param information_field 聊天内容的字段号
+ * @param room_id_field 房间id的字段号,0表示消息中没有房间id
+ * @param information 输出聊天内容在消息体中的起始地址,没有该字段时为nullptr
+ * @param information_size 输出聊天内容的字节数
+ * @param room_id 输出房间id,没有该字段时不修改
+ * @return bool 消息体是否合法
+ */
+inline bool scan_chat_fields(const char *body, size_t body_length, int information_field, int room_id_field,
+							 const char *&information, size_t &information_size, uint64_t &room_id) {
+	using google::protobuf::internal::WireFormatLite;
+	google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t *>(body), int(body_length));
+	information = nullptr;
+	information_size = 0;
+	while (uint32_t tag = input.ReadTag()) {
+		int field = WireFormatLite::GetTagFieldNumber(tag);
+		auto wire_type = WireFormatLite::GetTagWireType(tag);
+		if (field == information_field && wire_type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+			uint32_t size = 0;
+			if (!input.ReadVarint32(&size))
+				return false;
+			const char *data = body + input.CurrentPosition();
+			if (!input.Skip(int(size)))
+				return false;
+			information = data;
+			information_size = size;
+		}
+		else if (field == room_id_field && wire_type == WireFormatLite::WIRETYPE_VARINT) {
+			if (!input.ReadVarint64(&room_id))
+				return false;
+		}
+		else if (!WireFormatLite::SkipField(&input, tag)) {
+			return false;
+		}
+	}
+	if (!input.ConsumedEntireMessage())
+		return false;
+	//proto3的string字段要求UTF-8,与解码成消息对象时的检查一致
+	return valid_utf8(information, information_size);
+}
+
+/**
+ * @brief 不构造PRoomInformation,从MT_ROOM_INFO消息体中取出房间id和序号,不检查名字和聊天内容
+ * @param body 消息体
+ * @param body_length 消息体长度
+ * @param room_id 输出房间id,没有该字段时为0(大厅)
+ * @param seq 输出房间内的序号,没有该字段时为0
+ * @return bool 消息体是否合法
+ */
+inline bool scan_room_info(const char *body, size_t body_length, uint64_t &room_id, uint64_t &seq) {
+	using google::protobuf::internal::WireFormatLite;
+	google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t *>(body), int(body_length));
+	room_id = 0;
+	seq = 0;
+	while (uint32_t tag = input.ReadTag()) {
+		int field = WireFormatLite::GetTagFieldNumber(tag);
+		auto wire_type = WireFormatLite::GetTagWireType(tag);
+		if (field == PRoomInformation::kRoomIdFieldNumber && wire_type == WireFormatLite::WIRETYPE_VARINT) {
+			if (!input.ReadVarint64(&room_id))
+				return false;
+		}
+		else if (field == PRoomInformation::kSeqFieldNumber && wire_type == WireFormatLite::WIRETYPE_FIXED64) {
+			if (!input.ReadLittleEndian64(&seq))
+				return false;
+		}
+		else if (!WireFormatLite::SkipField(&input, tag)) {
+			return false;
+		}
+	}
+	return input.ConsumedEntireMessage();
+}
+
+/**
+ * @brief 不经过PRoomInformation对象构造MT_ROOM_INFO消息帧,把预先编码好的名字字段和聊天内容直接拼进消息体,
+ *        字段顺序和编码与protobuf序列化的结果相同,seq是编号最大的字段,总在消息体末尾
+ * @param name_field encode_string_field编码好的名字字段
+ * @param room_id 房间id
+ * @param information 聊天内容
+ * @param information_size 聊天内容的字节数
+ * @param seq 房间内的序号
+ * @param msg 输出的消息帧
+ * @return bool 超过消息体上限时返回false
+ */
+inline bool encode_room_info(const std::string &name_field, uint64_t room_id, const char *information,
+							 size_t information_size, uint64_t seq, chat_message &msg) {
+	using google::protobuf::io::CodedOutputStream;
+	using google::protobuf::internal::WireFormatLite;
+	//proto3省略默认值,空内容和0号房间不写,seq总是写,房间要原地改写它
+	size_t size = name_field.size() + 1 + 8;
+	if (information_size)
+		size += string_field_size(PRoomInformation::kInformationFieldNumber, information_size);
+	if (room_id)
+		size += 1 + CodedOutputStream::VarintSize64(room_id);
+	if (size > chat_message::max_body_length())
+		return false;
+
+	auto out = reinterpret_cast<uint8_t *>(msg.prepare_message(MT_ROOM_INFO, size));
+	memcpy(out, name_field.data(), name_field.size());
+	out += name_field.size();
+	if (information_size)
+		out = write_string_field(PRoomInformation::kInformationFieldNumber, information, information_size, out);
+	if (room_id)
+		out = WireFormatLite::WriteUInt64ToArray(PRoomInformation::kRoomIdFieldNumber, room_id, out);
+	WireFormatLite::WriteFixed64ToArray(PRoomInformation::kSeqFieldNumber, seq, out);
+	return true;
+}
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3008000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3008000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -43,39 +41,68 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_protocol_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_protocol_2eproto;
 class PBindName;
-class PBindNameDefaultTypeInternal;
+struct PBindNameDefaultTypeInternal;
 extern PBindNameDefaultTypeInternal _PBindName_default_instance_;
 class PChat;
-class PChatDefaultTypeInternal;
+struct PChatDefaultTypeInternal;
 extern PChatDefaultTypeInternal _PChat_default_instance_;
+class PDirectChat;
+struct PDirectChatDefaultTypeInternal;
+extern PDirectChatDefaultTypeInternal _PDirectChat_default_instance_;
+class PDirectInformation;
+struct PDirectInformationDefaultTypeInternal;
+extern PDirectInformationDefaultTypeInternal _PDirectInformation_default_instance_;
+class PJoinRoom;
+struct PJoinRoomDefaultTypeInternal;
+extern PJoinRoomDefaultTypeInternal _PJoinRoom_default_instance_;
+class PLeaveRoom;
+struct PLeaveRoomDefaultTypeInternal;
+extern PLeaveRoomDefaultTypeInternal _PLeaveRoom_default_instance_;
+class PNodeHello;
+struct PNodeHelloDefaultTypeInternal;
+extern PNodeHelloDefaultTypeInternal _PNodeHello_default_instance_;
+class PNodeRelay;
+struct PNodeRelayDefaultTypeInternal;
+extern PNodeRelayDefaultTypeInternal _PNodeRelay_default_instance_;
+class PNodeRooms;
+struct PNodeRoomsDefaultTypeInternal;
+extern PNodeRoomsDefaultTypeInternal _PNodeRooms_default_instance_;
+class PResyncTooFar;
+struct PResyncTooFarDefaultTypeInternal;
+extern PResyncTooFarDefaultTypeInternal _PResyncTooFar_default_instance_;
+class PRoomChat;
+struct PRoomChatDefaultTypeInternal;
+extern PRoomChatDefaultTypeInternal _PRoomChat_default_instance_;
 class PRoomInformation;
-class PRoomInformationDefaultTypeInternal;
+struct PRoomInformationDefaultTypeInternal;
 extern PRoomInformationDefaultTypeInternal _PRoomInformation_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
 template<> ::PBindName* Arena::CreateMaybeMessage<::PBindName>(Arena*);
 template<> ::PChat* Arena::CreateMaybeMessage<::PChat>(Arena*);
+template<> ::PDirectChat* Arena::CreateMaybeMessage<::PDirectChat>(Arena*);
+template<> ::PDirectInformation* Arena::CreateMaybeMessage<::PDirectInformation>(Arena*);
+template<> ::PJoinRoom* Arena::CreateMaybeMessage<::PJoinRoom>(Arena*);
+template<> ::PLeaveRoom* Arena::CreateMaybeMessage<::PLeaveRoom>(Arena*);
+template<> ::PNodeHello* Arena::CreateMaybeMessage<::PNodeHello>(Arena*);
+template<> ::PNodeRelay* Arena::CreateMaybeMessage<::PNodeRelay>(Arena*);
+template<> ::PNodeRooms* Arena::CreateMaybeMessage<::PNodeRooms>(Arena*);
+template<> ::PResyncTooFar* Arena::CreateMaybeMessage<::PResyncTooFar>(Arena*);
+template<> ::PRoomChat* Arena::CreateMaybeMessage<::PRoomChat>(Arena*);
 template<> ::PRoomInformation* Arena::CreateMaybeMessage<::PRoomInformation>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class PBindName :
+class PBindName final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PBindName) */ {
  public:
-  PBindName();
-  virtual ~PBindName();
+  inline PBindName() : PBindName(nullptr) {}
+  ~PBindName() override;
+  explicit PROTOBUF_CONSTEXPR PBindName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PBindName(const PBindName& from);
   PBindName(PBindName&& from) noexcept
@@ -88,8 +115,13 @@ class PBindName :
     return *this;
   }
   inline PBindName& operator=(PBindName&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -100,14 +132,14 @@ class PBindName :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBindName& default_instance() {
+    return *internal_default_instance();
   }
-  static const PBindName& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PBindName* internal_default_instance() {
     return reinterpret_cast<const PBindName*>(
                &_PBindName_default_instance_);
@@ -115,99 +147,115 @@ class PBindName :
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(PBindName* other);
   friend void swap(PBindName& a, PBindName& b) {
     a.Swap(&b);
   }
+  inline void Swap(PBindName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBindName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PBindName* New() const final {
-    return CreateMaybeMessage<PBindName>(nullptr);
-  }
-
-  PBindName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PBindName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PBindName>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PBindName& from);
-  void MergeFrom(const PBindName& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBindName& from) {
+    PBindName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PBindName* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "PBindName";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PBindName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:PBindName)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PChat :
+class PChat final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PChat) */ {
  public:
-  PChat();
-  virtual ~PChat();
+  inline PChat() : PChat(nullptr) {}
+  ~PChat() override;
+  explicit PROTOBUF_CONSTEXPR PChat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PChat(const PChat& from);
   PChat(PChat&& from) noexcept
@@ -220,8 +268,13 @@ class PChat :
     return *this;
   }
   inline PChat& operator=(PChat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -232,14 +285,14 @@ class PChat :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PChat& default_instance() {
+    return *internal_default_instance();
   }
-  static const PChat& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PChat* internal_default_instance() {
     return reinterpret_cast<const PChat*>(
                &_PChat_default_instance_);
@@ -247,99 +300,115 @@ class PChat :
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(PChat* other);
   friend void swap(PChat& a, PChat& b) {
     a.Swap(&b);
   }
+  inline void Swap(PChat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PChat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PChat* New() const final {
-    return CreateMaybeMessage<PChat>(nullptr);
-  }
-
-  PChat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PChat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PChat>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PChat& from);
-  void MergeFrom(const PChat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PChat& from) {
+    PChat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PChat* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "PChat";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kInformationFieldNumber = 1,
+  };
   // string information = 1;
   void clear_information();
-  static const int kInformationFieldNumber = 1;
   const std::string& information() const;
-  void set_information(const std::string& value);
-  void set_information(std::string&& value);
-  void set_information(const char* value);
-  void set_information(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
   std::string* mutable_information();
-  std::string* release_information();
+  PROTOBUF_NODISCARD std::string* release_information();
   void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
 
   // @@protoc_insertion_point(class_scope:PChat)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PRoomInformation :
+class PRoomInformation final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PRoomInformation) */ {
  public:
-  PRoomInformation();
-  virtual ~PRoomInformation();
+  inline PRoomInformation() : PRoomInformation(nullptr) {}
+  ~PRoomInformation() override;
+  explicit PROTOBUF_CONSTEXPR PRoomInformation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PRoomInformation(const PRoomInformation& from);
   PRoomInformation(PRoomInformation&& from) noexcept
@@ -352,8 +421,13 @@ class PRoomInformation :
     return *this;
   }
   inline PRoomInformation& operator=(PRoomInformation&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -364,14 +438,14 @@ class PRoomInformation :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PRoomInformation& default_instance() {
+    return *internal_default_instance();
   }
-  static const PRoomInformation& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PRoomInformation* internal_default_instance() {
     return reinterpret_cast<const PRoomInformation*>(
                &_PRoomInformation_default_instance_);
@@ -379,326 +453,2449 @@ class PRoomInformation :
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(PRoomInformation* other);
   friend void swap(PRoomInformation& a, PRoomInformation& b) {
     a.Swap(&b);
   }
+  inline void Swap(PRoomInformation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PRoomInformation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PRoomInformation* New() const final {
-    return CreateMaybeMessage<PRoomInformation>(nullptr);
-  }
-
-  PRoomInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PRoomInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PRoomInformation>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PRoomInformation& from);
-  void MergeFrom(const PRoomInformation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PRoomInformation& from) {
+    PRoomInformation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PRoomInformation* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "PRoomInformation";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PRoomInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kInformationFieldNumber = 2,
+    kRoomIdFieldNumber = 3,
+    kSeqFieldNumber = 4,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string information = 2;
   void clear_information();
-  static const int kInformationFieldNumber = 2;
   const std::string& information() const;
-  void set_information(const std::string& value);
-  void set_information(std::string&& value);
-  void set_information(const char* value);
-  void set_information(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
   std::string* mutable_information();
-  std::string* release_information();
+  PROTOBUF_NODISCARD std::string* release_information();
   void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
+
+  // uint64 room_id = 3;
+  void clear_room_id();
+  uint64_t room_id() const;
+  void set_room_id(uint64_t value);
+  private:
+  uint64_t _internal_room_id() const;
+  void _internal_set_room_id(uint64_t value);
+  public:
+
+  // fixed64 seq = 4;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:PRoomInformation)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    uint64_t room_id_;
+    uint64_t seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PJoinRoom final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PJoinRoom) */ {
+ public:
+  inline PJoinRoom() : PJoinRoom(nullptr) {}
+  ~PJoinRoom() override;
+  explicit PROTOBUF_CONSTEXPR PJoinRoom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  PJoinRoom(const PJoinRoom& from);
+  PJoinRoom(PJoinRoom&& from) noexcept
+    : PJoinRoom() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// PBindName
+  inline PJoinRoom& operator=(const PJoinRoom& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PJoinRoom& operator=(PJoinRoom&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string name = 1;
-inline void PBindName::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& PBindName::name() const {
-  // @@protoc_insertion_point(field_get:PBindName.name)
-  return name_.GetNoArena();
-}
-inline void PBindName::set_name(const std::string& value) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:PBindName.name)
-}
-inline void PBindName::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:PBindName.name)
-}
-inline void PBindName::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:PBindName.name)
-}
-inline void PBindName::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:PBindName.name)
-}
-inline std::string* PBindName::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:PBindName.name)
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* PBindName::release_name() {
-  // @@protoc_insertion_point(field_release:PBindName.name)
-  
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void PBindName::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:PBindName.name)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PJoinRoom& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PJoinRoom* internal_default_instance() {
+    return reinterpret_cast<const PJoinRoom*>(
+               &_PJoinRoom_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-// -------------------------------------------------------------------
+  friend void swap(PJoinRoom& a, PJoinRoom& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PJoinRoom* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PJoinRoom* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// PChat
+  // implements Message ----------------------------------------------
 
-// string information = 1;
-inline void PChat::clear_information() {
-  information_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& PChat::information() const {
-  // @@protoc_insertion_point(field_get:PChat.information)
-  return information_.GetNoArena();
-}
-inline void PChat::set_information(const std::string& value) {
-  
-  information_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:PChat.information)
-}
-inline void PChat::set_information(std::string&& value) {
-  
-  information_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:PChat.information)
-}
-inline void PChat::set_information(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  information_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:PChat.information)
-}
-inline void PChat::set_information(const char* value, size_t size) {
-  
-  information_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:PChat.information)
-}
-inline std::string* PChat::mutable_information() {
-  
-  // @@protoc_insertion_point(field_mutable:PChat.information)
-  return information_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* PChat::release_information() {
-  // @@protoc_insertion_point(field_release:PChat.information)
-  
-  return information_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void PChat::set_allocated_information(std::string* information) {
-  if (information != nullptr) {
-    
-  } else {
-    
+  PJoinRoom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PJoinRoom>(arena);
   }
-  information_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), information);
-  // @@protoc_insertion_point(field_set_allocated:PChat.information)
-}
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PJoinRoom& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PJoinRoom& from) {
+    PJoinRoom::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PJoinRoom* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PJoinRoom";
+  }
+  protected:
+  explicit PJoinRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomIdFieldNumber = 1,
+    kLastSeqFieldNumber = 2,
+  };
+  // uint64 room_id = 1;
+  void clear_room_id();
+  uint64_t room_id() const;
+  void set_room_id(uint64_t value);
+  private:
+  uint64_t _internal_room_id() const;
+  void _internal_set_room_id(uint64_t value);
+  public:
+
+  // uint64 last_seq = 2;
+  void clear_last_seq();
+  uint64_t last_seq() const;
+  void set_last_seq(uint64_t value);
+  private:
+  uint64_t _internal_last_seq() const;
+  void _internal_set_last_seq(uint64_t value);
+  public:
 
+  // @@protoc_insertion_point(class_scope:PJoinRoom)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t room_id_;
+    uint64_t last_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
 // -------------------------------------------------------------------
 
-// PRoomInformation
+class PLeaveRoom final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PLeaveRoom) */ {
+ public:
+  inline PLeaveRoom() : PLeaveRoom(nullptr) {}
+  ~PLeaveRoom() override;
+  explicit PROTOBUF_CONSTEXPR PLeaveRoom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// string name = 1;
-inline void PRoomInformation::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& PRoomInformation::name() const {
-  // @@protoc_insertion_point(field_get:PRoomInformation.name)
-  return name_.GetNoArena();
-}
-inline void PRoomInformation::set_name(const std::string& value) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:PRoomInformation.name)
-}
-inline void PRoomInformation::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:PRoomInformation.name)
-}
-inline void PRoomInformation::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:PRoomInformation.name)
-}
-inline void PRoomInformation::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:PRoomInformation.name)
-}
-inline std::string* PRoomInformation::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:PRoomInformation.name)
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* PRoomInformation::release_name() {
-  // @@protoc_insertion_point(field_release:PRoomInformation.name)
-  
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void PRoomInformation::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
+  PLeaveRoom(const PLeaveRoom& from);
+  PLeaveRoom(PLeaveRoom&& from) noexcept
+    : PLeaveRoom() {
+    *this = ::std::move(from);
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:PRoomInformation.name)
-}
 
-// string information = 2;
-inline void PRoomInformation::clear_information() {
-  information_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& PRoomInformation::information() const {
-  // @@protoc_insertion_point(field_get:PRoomInformation.information)
-  return information_.GetNoArena();
-}
-inline void PRoomInformation::set_information(const std::string& value) {
-  
-  information_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  inline PLeaveRoom& operator=(const PLeaveRoom& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PLeaveRoom& operator=(PLeaveRoom&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PLeaveRoom& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PLeaveRoom* internal_default_instance() {
+    return reinterpret_cast<const PLeaveRoom*>(
+               &_PLeaveRoom_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(PLeaveRoom& a, PLeaveRoom& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PLeaveRoom* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PLeaveRoom* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PLeaveRoom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PLeaveRoom>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PLeaveRoom& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PLeaveRoom& from) {
+    PLeaveRoom::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PLeaveRoom* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PLeaveRoom";
+  }
+  protected:
+  explicit PLeaveRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomIdFieldNumber = 1,
+  };
+  // uint64 room_id = 1;
+  void clear_room_id();
+  uint64_t room_id() const;
+  void set_room_id(uint64_t value);
+  private:
+  uint64_t _internal_room_id() const;
+  void _internal_set_room_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PLeaveRoom)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t room_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PRoomChat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PRoomChat) */ {
+ public:
+  inline PRoomChat() : PRoomChat(nullptr) {}
+  ~PRoomChat() override;
+  explicit PROTOBUF_CONSTEXPR PRoomChat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PRoomChat(const PRoomChat& from);
+  PRoomChat(PRoomChat&& from) noexcept
+    : PRoomChat() {
+    *this = ::std::move(from);
+  }
+
+  inline PRoomChat& operator=(const PRoomChat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PRoomChat& operator=(PRoomChat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PRoomChat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PRoomChat* internal_default_instance() {
+    return reinterpret_cast<const PRoomChat*>(
+               &_PRoomChat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PRoomChat& a, PRoomChat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PRoomChat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PRoomChat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PRoomChat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PRoomChat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PRoomChat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PRoomChat& from) {
+    PRoomChat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PRoomChat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PRoomChat";
+  }
+  protected:
+  explicit PRoomChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInformationFieldNumber = 2,
+    kRoomIdFieldNumber = 1,
+  };
+  // string information = 2;
+  void clear_information();
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
+
+  // uint64 room_id = 1;
+  void clear_room_id();
+  uint64_t room_id() const;
+  void set_room_id(uint64_t value);
+  private:
+  uint64_t _internal_room_id() const;
+  void _internal_set_room_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PRoomChat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    uint64_t room_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PResyncTooFar final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PResyncTooFar) */ {
+ public:
+  inline PResyncTooFar() : PResyncTooFar(nullptr) {}
+  ~PResyncTooFar() override;
+  explicit PROTOBUF_CONSTEXPR PResyncTooFar(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PResyncTooFar(const PResyncTooFar& from);
+  PResyncTooFar(PResyncTooFar&& from) noexcept
+    : PResyncTooFar() {
+    *this = ::std::move(from);
+  }
+
+  inline PResyncTooFar& operator=(const PResyncTooFar& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PResyncTooFar& operator=(PResyncTooFar&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PResyncTooFar& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PResyncTooFar* internal_default_instance() {
+    return reinterpret_cast<const PResyncTooFar*>(
+               &_PResyncTooFar_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PResyncTooFar& a, PResyncTooFar& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PResyncTooFar* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PResyncTooFar* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PResyncTooFar* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PResyncTooFar>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PResyncTooFar& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PResyncTooFar& from) {
+    PResyncTooFar::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PResyncTooFar* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PResyncTooFar";
+  }
+  protected:
+  explicit PResyncTooFar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomIdFieldNumber = 1,
+    kLastSeqFieldNumber = 2,
+    kFirstSeqFieldNumber = 3,
+  };
+  // uint64 room_id = 1;
+  void clear_room_id();
+  uint64_t room_id() const;
+  void set_room_id(uint64_t value);
+  private:
+  uint64_t _internal_room_id() const;
+  void _internal_set_room_id(uint64_t value);
+  public:
+
+  // uint64 last_seq = 2;
+  void clear_last_seq();
+  uint64_t last_seq() const;
+  void set_last_seq(uint64_t value);
+  private:
+  uint64_t _internal_last_seq() const;
+  void _internal_set_last_seq(uint64_t value);
+  public:
+
+  // uint64 first_seq = 3;
+  void clear_first_seq();
+  uint64_t first_seq() const;
+  void set_first_seq(uint64_t value);
+  private:
+  uint64_t _internal_first_seq() const;
+  void _internal_set_first_seq(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PResyncTooFar)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t room_id_;
+    uint64_t last_seq_;
+    uint64_t first_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PDirectChat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PDirectChat) */ {
+ public:
+  inline PDirectChat() : PDirectChat(nullptr) {}
+  ~PDirectChat() override;
+  explicit PROTOBUF_CONSTEXPR PDirectChat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PDirectChat(const PDirectChat& from);
+  PDirectChat(PDirectChat&& from) noexcept
+    : PDirectChat() {
+    *this = ::std::move(from);
+  }
+
+  inline PDirectChat& operator=(const PDirectChat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PDirectChat& operator=(PDirectChat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PDirectChat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PDirectChat* internal_default_instance() {
+    return reinterpret_cast<const PDirectChat*>(
+               &_PDirectChat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PDirectChat& a, PDirectChat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PDirectChat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PDirectChat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PDirectChat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PDirectChat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PDirectChat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PDirectChat& from) {
+    PDirectChat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PDirectChat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PDirectChat";
+  }
+  protected:
+  explicit PDirectChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kToFieldNumber = 1,
+    kInformationFieldNumber = 2,
+  };
+  // string to = 1;
+  void clear_to();
+  const std::string& to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_to();
+  PROTOBUF_NODISCARD std::string* release_to();
+  void set_allocated_to(std::string* to);
+  private:
+  const std::string& _internal_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_to(const std::string& value);
+  std::string* _internal_mutable_to();
+  public:
+
+  // string information = 2;
+  void clear_information();
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
+
+  // @@protoc_insertion_point(class_scope:PDirectChat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr to_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PDirectInformation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PDirectInformation) */ {
+ public:
+  inline PDirectInformation() : PDirectInformation(nullptr) {}
+  ~PDirectInformation() override;
+  explicit PROTOBUF_CONSTEXPR PDirectInformation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PDirectInformation(const PDirectInformation& from);
+  PDirectInformation(PDirectInformation&& from) noexcept
+    : PDirectInformation() {
+    *this = ::std::move(from);
+  }
+
+  inline PDirectInformation& operator=(const PDirectInformation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PDirectInformation& operator=(PDirectInformation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PDirectInformation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PDirectInformation* internal_default_instance() {
+    return reinterpret_cast<const PDirectInformation*>(
+               &_PDirectInformation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(PDirectInformation& a, PDirectInformation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PDirectInformation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PDirectInformation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PDirectInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PDirectInformation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PDirectInformation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PDirectInformation& from) {
+    PDirectInformation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PDirectInformation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PDirectInformation";
+  }
+  protected:
+  explicit PDirectInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kInformationFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string information = 2;
+  void clear_information();
+  const std::string& information() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_information(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_information();
+  PROTOBUF_NODISCARD std::string* release_information();
+  void set_allocated_information(std::string* information);
+  private:
+  const std::string& _internal_information() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_information(const std::string& value);
+  std::string* _internal_mutable_information();
+  public:
+
+  // @@protoc_insertion_point(class_scope:PDirectInformation)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr information_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PNodeHello final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PNodeHello) */ {
+ public:
+  inline PNodeHello() : PNodeHello(nullptr) {}
+  ~PNodeHello() override;
+  explicit PROTOBUF_CONSTEXPR PNodeHello(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PNodeHello(const PNodeHello& from);
+  PNodeHello(PNodeHello&& from) noexcept
+    : PNodeHello() {
+    *this = ::std::move(from);
+  }
+
+  inline PNodeHello& operator=(const PNodeHello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PNodeHello& operator=(PNodeHello&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PNodeHello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PNodeHello* internal_default_instance() {
+    return reinterpret_cast<const PNodeHello*>(
+               &_PNodeHello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PNodeHello& a, PNodeHello& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PNodeHello* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PNodeHello* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PNodeHello* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PNodeHello>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PNodeHello& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PNodeHello& from) {
+    PNodeHello::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PNodeHello* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PNodeHello";
+  }
+  protected:
+  explicit PNodeHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeIdFieldNumber = 1,
+  };
+  // uint64 node_id = 1;
+  void clear_node_id();
+  uint64_t node_id() const;
+  void set_node_id(uint64_t value);
+  private:
+  uint64_t _internal_node_id() const;
+  void _internal_set_node_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PNodeHello)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t node_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PNodeRooms final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PNodeRooms) */ {
+ public:
+  inline PNodeRooms() : PNodeRooms(nullptr) {}
+  ~PNodeRooms() override;
+  explicit PROTOBUF_CONSTEXPR PNodeRooms(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PNodeRooms(const PNodeRooms& from);
+  PNodeRooms(PNodeRooms&& from) noexcept
+    : PNodeRooms() {
+    *this = ::std::move(from);
+  }
+
+  inline PNodeRooms& operator=(const PNodeRooms& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PNodeRooms& operator=(PNodeRooms&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PNodeRooms& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PNodeRooms* internal_default_instance() {
+    return reinterpret_cast<const PNodeRooms*>(
+               &_PNodeRooms_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PNodeRooms& a, PNodeRooms& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PNodeRooms* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PNodeRooms* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PNodeRooms* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PNodeRooms>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PNodeRooms& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PNodeRooms& from) {
+    PNodeRooms::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PNodeRooms* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PNodeRooms";
+  }
+  protected:
+  explicit PNodeRooms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomIdsFieldNumber = 1,
+  };
+  // repeated uint64 room_ids = 1;
+  int room_ids_size() const;
+  private:
+  int _internal_room_ids_size() const;
+  public:
+  void clear_room_ids();
+  private:
+  uint64_t _internal_room_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_room_ids() const;
+  void _internal_add_room_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_room_ids();
+  public:
+  uint64_t room_ids(int index) const;
+  void set_room_ids(int index, uint64_t value);
+  void add_room_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      room_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_room_ids();
+
+  // @@protoc_insertion_point(class_scope:PNodeRooms)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > room_ids_;
+    mutable std::atomic<int> _room_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PNodeRelay final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PNodeRelay) */ {
+ public:
+  inline PNodeRelay() : PNodeRelay(nullptr) {}
+  ~PNodeRelay() override;
+  explicit PROTOBUF_CONSTEXPR PNodeRelay(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PNodeRelay(const PNodeRelay& from);
+  PNodeRelay(PNodeRelay&& from) noexcept
+    : PNodeRelay() {
+    *this = ::std::move(from);
+  }
+
+  inline PNodeRelay& operator=(const PNodeRelay& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PNodeRelay& operator=(PNodeRelay&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PNodeRelay& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PNodeRelay* internal_default_instance() {
+    return reinterpret_cast<const PNodeRelay*>(
+               &_PNodeRelay_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(PNodeRelay& a, PNodeRelay& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PNodeRelay* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PNodeRelay* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PNodeRelay* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PNodeRelay>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PNodeRelay& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PNodeRelay& from) {
+    PNodeRelay::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PNodeRelay* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PNodeRelay";
+  }
+  protected:
+  explicit PNodeRelay(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBodyFieldNumber = 3,
+    kRoomIdFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // bytes body = 3;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // uint64 room_id = 1;
+  void clear_room_id();
+  uint64_t room_id() const;
+  void set_room_id(uint64_t value);
+  private:
+  uint64_t _internal_room_id() const;
+  void _internal_set_room_id(uint64_t value);
+  public:
+
+  // int32 type = 2;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PNodeRelay)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    uint64_t room_id_;
+    int32_t type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PBindName
+
+// string name = 1;
+inline void PBindName::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PBindName::name() const {
+  // @@protoc_insertion_point(field_get:PBindName.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBindName::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PBindName.name)
+}
+inline std::string* PBindName::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:PBindName.name)
+  return _s;
+}
+inline const std::string& PBindName::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PBindName::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBindName::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBindName::release_name() {
+  // @@protoc_insertion_point(field_release:PBindName.name)
+  return _impl_.name_.Release();
+}
+inline void PBindName::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PBindName.name)
+}
+
+// -------------------------------------------------------------------
+
+// PChat
+
+// string information = 1;
+inline void PChat::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PChat::information() const {
+  // @@protoc_insertion_point(field_get:PChat.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PChat::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PChat.information)
+}
+inline std::string* PChat::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:PChat.information)
+  return _s;
+}
+inline const std::string& PChat::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PChat::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PChat::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PChat::release_information() {
+  // @@protoc_insertion_point(field_release:PChat.information)
+  return _impl_.information_.Release();
+}
+inline void PChat::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PChat.information)
+}
+
+// -------------------------------------------------------------------
+
+// PRoomInformation
+
+// string name = 1;
+inline void PRoomInformation::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PRoomInformation::name() const {
+  // @@protoc_insertion_point(field_get:PRoomInformation.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PRoomInformation::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PRoomInformation.name)
+}
+inline std::string* PRoomInformation::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:PRoomInformation.name)
+  return _s;
+}
+inline const std::string& PRoomInformation::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PRoomInformation::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::release_name() {
+  // @@protoc_insertion_point(field_release:PRoomInformation.name)
+  return _impl_.name_.Release();
+}
+inline void PRoomInformation::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PRoomInformation.name)
+}
+
+// string information = 2;
+inline void PRoomInformation::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PRoomInformation::information() const {
+  // @@protoc_insertion_point(field_get:PRoomInformation.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PRoomInformation::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:PRoomInformation.information)
 }
-inline void PRoomInformation::set_information(std::string&& value) {
+inline std::string* PRoomInformation::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:PRoomInformation.information)
+  return _s;
+}
+inline const std::string& PRoomInformation::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PRoomInformation::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PRoomInformation::_internal_mutable_information() {
   
-  information_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:PRoomInformation.information)
+  return _impl_.information_.Mutable(GetArenaForAllocation());
 }
-inline void PRoomInformation::set_information(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline std::string* PRoomInformation::release_information() {
+  // @@protoc_insertion_point(field_release:PRoomInformation.information)
+  return _impl_.information_.Release();
+}
+inline void PRoomInformation::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PRoomInformation.information)
+}
+
+// uint64 room_id = 3;
+inline void PRoomInformation::clear_room_id() {
+  _impl_.room_id_ = uint64_t{0u};
+}
+inline uint64_t PRoomInformation::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint64_t PRoomInformation::room_id() const {
+  // @@protoc_insertion_point(field_get:PRoomInformation.room_id)
+  return _internal_room_id();
+}
+inline void PRoomInformation::_internal_set_room_id(uint64_t value) {
   
-  information_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:PRoomInformation.information)
+  _impl_.room_id_ = value;
 }
-inline void PRoomInformation::set_information(const char* value, size_t size) {
+inline void PRoomInformation::set_room_id(uint64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:PRoomInformation.room_id)
+}
+
+// fixed64 seq = 4;
+inline void PRoomInformation::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t PRoomInformation::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t PRoomInformation::seq() const {
+  // @@protoc_insertion_point(field_get:PRoomInformation.seq)
+  return _internal_seq();
+}
+inline void PRoomInformation::_internal_set_seq(uint64_t value) {
   
-  information_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:PRoomInformation.information)
+  _impl_.seq_ = value;
 }
-inline std::string* PRoomInformation::mutable_information() {
+inline void PRoomInformation::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:PRoomInformation.seq)
+}
+
+// -------------------------------------------------------------------
+
+// PJoinRoom
+
+// uint64 room_id = 1;
+inline void PJoinRoom::clear_room_id() {
+  _impl_.room_id_ = uint64_t{0u};
+}
+inline uint64_t PJoinRoom::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint64_t PJoinRoom::room_id() const {
+  // @@protoc_insertion_point(field_get:PJoinRoom.room_id)
+  return _internal_room_id();
+}
+inline void PJoinRoom::_internal_set_room_id(uint64_t value) {
   
-  // @@protoc_insertion_point(field_mutable:PRoomInformation.information)
-  return information_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.room_id_ = value;
 }
-inline std::string* PRoomInformation::release_information() {
-  // @@protoc_insertion_point(field_release:PRoomInformation.information)
+inline void PJoinRoom::set_room_id(uint64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:PJoinRoom.room_id)
+}
+
+// uint64 last_seq = 2;
+inline void PJoinRoom::clear_last_seq() {
+  _impl_.last_seq_ = uint64_t{0u};
+}
+inline uint64_t PJoinRoom::_internal_last_seq() const {
+  return _impl_.last_seq_;
+}
+inline uint64_t PJoinRoom::last_seq() const {
+  // @@protoc_insertion_point(field_get:PJoinRoom.last_seq)
+  return _internal_last_seq();
+}
+inline void PJoinRoom::_internal_set_last_seq(uint64_t value) {
   
-  return information_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.last_seq_ = value;
 }
-inline void PRoomInformation::set_allocated_information(std::string* information) {
+inline void PJoinRoom::set_last_seq(uint64_t value) {
+  _internal_set_last_seq(value);
+  // @@protoc_insertion_point(field_set:PJoinRoom.last_seq)
+}
+
+// -------------------------------------------------------------------
+
+// PLeaveRoom
+
+// uint64 room_id = 1;
+inline void PLeaveRoom::clear_room_id() {
+  _impl_.room_id_ = uint64_t{0u};
+}
+inline uint64_t PLeaveRoom::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint64_t PLeaveRoom::room_id() const {
+  // @@protoc_insertion_point(field_get:PLeaveRoom.room_id)
+  return _internal_room_id();
+}
+inline void PLeaveRoom::_internal_set_room_id(uint64_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void PLeaveRoom::set_room_id(uint64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:PLeaveRoom.room_id)
+}
+
+// -------------------------------------------------------------------
+
+// PRoomChat
+
+// uint64 room_id = 1;
+inline void PRoomChat::clear_room_id() {
+  _impl_.room_id_ = uint64_t{0u};
+}
+inline uint64_t PRoomChat::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint64_t PRoomChat::room_id() const {
+  // @@protoc_insertion_point(field_get:PRoomChat.room_id)
+  return _internal_room_id();
+}
+inline void PRoomChat::_internal_set_room_id(uint64_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void PRoomChat::set_room_id(uint64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:PRoomChat.room_id)
+}
+
+// string information = 2;
+inline void PRoomChat::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PRoomChat::information() const {
+  // @@protoc_insertion_point(field_get:PRoomChat.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PRoomChat::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PRoomChat.information)
+}
+inline std::string* PRoomChat::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:PRoomChat.information)
+  return _s;
+}
+inline const std::string& PRoomChat::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PRoomChat::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PRoomChat::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PRoomChat::release_information() {
+  // @@protoc_insertion_point(field_release:PRoomChat.information)
+  return _impl_.information_.Release();
+}
+inline void PRoomChat::set_allocated_information(std::string* information) {
   if (information != nullptr) {
     
   } else {
     
   }
-  information_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), information);
-  // @@protoc_insertion_point(field_set_allocated:PRoomInformation.information)
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PRoomChat.information)
+}
+
+// -------------------------------------------------------------------
+
+// PResyncTooFar
+
+// uint64 room_id = 1;
+inline void PResyncTooFar::clear_room_id() {
+  _impl_.room_id_ = uint64_t{0u};
+}
+inline uint64_t PResyncTooFar::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint64_t PResyncTooFar::room_id() const {
+  // @@protoc_insertion_point(field_get:PResyncTooFar.room_id)
+  return _internal_room_id();
+}
+inline void PResyncTooFar::_internal_set_room_id(uint64_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void PResyncTooFar::set_room_id(uint64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:PResyncTooFar.room_id)
+}
+
+// uint64 last_seq = 2;
+inline void PResyncTooFar::clear_last_seq() {
+  _impl_.last_seq_ = uint64_t{0u};
+}
+inline uint64_t PResyncTooFar::_internal_last_seq() const {
+  return _impl_.last_seq_;
+}
+inline uint64_t PResyncTooFar::last_seq() const {
+  // @@protoc_insertion_point(field_get:PResyncTooFar.last_seq)
+  return _internal_last_seq();
+}
+inline void PResyncTooFar::_internal_set_last_seq(uint64_t value) {
+  
+  _impl_.last_seq_ = value;
+}
+inline void PResyncTooFar::set_last_seq(uint64_t value) {
+  _internal_set_last_seq(value);
+  // @@protoc_insertion_point(field_set:PResyncTooFar.last_seq)
+}
+
+// uint64 first_seq = 3;
+inline void PResyncTooFar::clear_first_seq() {
+  _impl_.first_seq_ = uint64_t{0u};
+}
+inline uint64_t PResyncTooFar::_internal_first_seq() const {
+  return _impl_.first_seq_;
+}
+inline uint64_t PResyncTooFar::first_seq() const {
+  // @@protoc_insertion_point(field_get:PResyncTooFar.first_seq)
+  return _internal_first_seq();
+}
+inline void PResyncTooFar::_internal_set_first_seq(uint64_t value) {
+  
+  _impl_.first_seq_ = value;
+}
+inline void PResyncTooFar::set_first_seq(uint64_t value) {
+  _internal_set_first_seq(value);
+  // @@protoc_insertion_point(field_set:PResyncTooFar.first_seq)
+}
+
+// -------------------------------------------------------------------
+
+// PDirectChat
+
+// string to = 1;
+inline void PDirectChat::clear_to() {
+  _impl_.to_.ClearToEmpty();
+}
+inline const std::string& PDirectChat::to() const {
+  // @@protoc_insertion_point(field_get:PDirectChat.to)
+  return _internal_to();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectChat::set_to(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PDirectChat.to)
+}
+inline std::string* PDirectChat::mutable_to() {
+  std::string* _s = _internal_mutable_to();
+  // @@protoc_insertion_point(field_mutable:PDirectChat.to)
+  return _s;
+}
+inline const std::string& PDirectChat::_internal_to() const {
+  return _impl_.to_.Get();
+}
+inline void PDirectChat::_internal_set_to(const std::string& value) {
+  
+  _impl_.to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PDirectChat::_internal_mutable_to() {
+  
+  return _impl_.to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PDirectChat::release_to() {
+  // @@protoc_insertion_point(field_release:PDirectChat.to)
+  return _impl_.to_.Release();
+}
+inline void PDirectChat::set_allocated_to(std::string* to) {
+  if (to != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.to_.SetAllocated(to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.to_.IsDefault()) {
+    _impl_.to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PDirectChat.to)
+}
+
+// string information = 2;
+inline void PDirectChat::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PDirectChat::information() const {
+  // @@protoc_insertion_point(field_get:PDirectChat.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectChat::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PDirectChat.information)
+}
+inline std::string* PDirectChat::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:PDirectChat.information)
+  return _s;
+}
+inline const std::string& PDirectChat::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PDirectChat::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PDirectChat::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PDirectChat::release_information() {
+  // @@protoc_insertion_point(field_release:PDirectChat.information)
+  return _impl_.information_.Release();
+}
+inline void PDirectChat::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PDirectChat.information)
+}
+
+// -------------------------------------------------------------------
+
+// PDirectInformation
+
+// string name = 1;
+inline void PDirectInformation::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PDirectInformation::name() const {
+  // @@protoc_insertion_point(field_get:PDirectInformation.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectInformation::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PDirectInformation.name)
+}
+inline std::string* PDirectInformation::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:PDirectInformation.name)
+  return _s;
+}
+inline const std::string& PDirectInformation::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PDirectInformation::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PDirectInformation::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PDirectInformation::release_name() {
+  // @@protoc_insertion_point(field_release:PDirectInformation.name)
+  return _impl_.name_.Release();
+}
+inline void PDirectInformation::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PDirectInformation.name)
+}
+
+// string information = 2;
+inline void PDirectInformation::clear_information() {
+  _impl_.information_.ClearToEmpty();
+}
+inline const std::string& PDirectInformation::information() const {
+  // @@protoc_insertion_point(field_get:PDirectInformation.information)
+  return _internal_information();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PDirectInformation::set_information(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.information_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PDirectInformation.information)
+}
+inline std::string* PDirectInformation::mutable_information() {
+  std::string* _s = _internal_mutable_information();
+  // @@protoc_insertion_point(field_mutable:PDirectInformation.information)
+  return _s;
+}
+inline const std::string& PDirectInformation::_internal_information() const {
+  return _impl_.information_.Get();
+}
+inline void PDirectInformation::_internal_set_information(const std::string& value) {
+  
+  _impl_.information_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PDirectInformation::_internal_mutable_information() {
+  
+  return _impl_.information_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PDirectInformation::release_information() {
+  // @@protoc_insertion_point(field_release:PDirectInformation.information)
+  return _impl_.information_.Release();
+}
+inline void PDirectInformation::set_allocated_information(std::string* information) {
+  if (information != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.information_.SetAllocated(information, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.information_.IsDefault()) {
+    _impl_.information_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PDirectInformation.information)
+}
+
+// -------------------------------------------------------------------
+
+// PNodeHello
+
+// uint64 node_id = 1;
+inline void PNodeHello::clear_node_id() {
+  _impl_.node_id_ = uint64_t{0u};
+}
+inline uint64_t PNodeHello::_internal_node_id() const {
+  return _impl_.node_id_;
+}
+inline uint64_t PNodeHello::node_id() const {
+  // @@protoc_insertion_point(field_get:PNodeHello.node_id)
+  return _internal_node_id();
+}
+inline void PNodeHello::_internal_set_node_id(uint64_t value) {
+  
+  _impl_.node_id_ = value;
+}
+inline void PNodeHello::set_node_id(uint64_t value) {
+  _internal_set_node_id(value);
+  // @@protoc_insertion_point(field_set:PNodeHello.node_id)
+}
+
+// -------------------------------------------------------------------
+
+// PNodeRooms
+
+// repeated uint64 room_ids = 1;
+inline int PNodeRooms::_internal_room_ids_size() const {
+  return _impl_.room_ids_.size();
+}
+inline int PNodeRooms::room_ids_size() const {
+  return _internal_room_ids_size();
+}
+inline void PNodeRooms::clear_room_ids() {
+  _impl_.room_ids_.Clear();
+}
+inline uint64_t PNodeRooms::_internal_room_ids(int index) const {
+  return _impl_.room_ids_.Get(index);
+}
+inline uint64_t PNodeRooms::room_ids(int index) const {
+  // @@protoc_insertion_point(field_get:PNodeRooms.room_ids)
+  return _internal_room_ids(index);
+}
+inline void PNodeRooms::set_room_ids(int index, uint64_t value) {
+  _impl_.room_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PNodeRooms.room_ids)
+}
+inline void PNodeRooms::_internal_add_room_ids(uint64_t value) {
+  _impl_.room_ids_.Add(value);
+}
+inline void PNodeRooms::add_room_ids(uint64_t value) {
+  _internal_add_room_ids(value);
+  // @@protoc_insertion_point(field_add:PNodeRooms.room_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+PNodeRooms::_internal_room_ids() const {
+  return _impl_.room_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+PNodeRooms::room_ids() const {
+  // @@protoc_insertion_point(field_list:PNodeRooms.room_ids)
+  return _internal_room_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+PNodeRooms::_internal_mutable_room_ids() {
+  return &_impl_.room_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+PNodeRooms::mutable_room_ids() {
+  // @@protoc_insertion_point(field_mutable_list:PNodeRooms.room_ids)
+  return _internal_mutable_room_ids();
+}
+
+// -------------------------------------------------------------------
+
+// PNodeRelay
+
+// uint64 room_id = 1;
+inline void PNodeRelay::clear_room_id() {
+  _impl_.room_id_ = uint64_t{0u};
+}
+inline uint64_t PNodeRelay::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint64_t PNodeRelay::room_id() const {
+  // @@protoc_insertion_point(field_get:PNodeRelay.room_id)
+  return _internal_room_id();
+}
+inline void PNodeRelay::_internal_set_room_id(uint64_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void PNodeRelay::set_room_id(uint64_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:PNodeRelay.room_id)
+}
+
+// int32 type = 2;
+inline void PNodeRelay::clear_type() {
+  _impl_.type_ = 0;
+}
+inline int32_t PNodeRelay::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t PNodeRelay::type() const {
+  // @@protoc_insertion_point(field_get:PNodeRelay.type)
+  return _internal_type();
+}
+inline void PNodeRelay::_internal_set_type(int32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void PNodeRelay::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:PNodeRelay.type)
+}
+
+// bytes body = 3;
+inline void PNodeRelay::clear_body() {
+  _impl_.body_.ClearToEmpty();
+}
+inline const std::string& PNodeRelay::body() const {
+  // @@protoc_insertion_point(field_get:PNodeRelay.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PNodeRelay::set_body(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PNodeRelay.body)
+}
+inline std::string* PNodeRelay::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:PNodeRelay.body)
+  return _s;
+}
+inline const std::string& PNodeRelay::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void PNodeRelay::_internal_set_body(const std::string& value) {
+  
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PNodeRelay::_internal_mutable_body() {
+  
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PNodeRelay::release_body() {
+  // @@protoc_insertion_point(field_release:PNodeRelay.body)
+  return _impl_.body_.Release();
+}
+inline void PNodeRelay::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PNodeRelay.body)
 }
 
 #ifdef __GNUC__
@@ -708,6 +2905,24 @@ inline void PRoomInformation::set_allocated_information(std::string* information
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
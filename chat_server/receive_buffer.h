@@ -0,0 +1,133 @@
+﻿#pragma once
+#include <cstring>
+#include <vector>
+#include "struct_header.h"
+#include "chat_message.h"
+
+/**
+ * @brief 每个session的接收缓冲区,由async_read_some填充,[begin_, end_)为已收到未解析的数据
+ *        跨越缓冲区末尾的半帧会被搬到缓冲区头部;超过容量的大帧会临时扩容,消费完后收缩
+ */
+class receive_buffer {
+public:
+	enum { default_capacity = 4 * 1024 };
+
+	explicit receive_buffer(size_t capacity = default_capacity)
+		: buffer_(capacity), initial_capacity_(capacity) {
+	}
+
+	/**
+	 * @brief 已收到未解析的数据
+	 * @param
+	 * @return const char*
+	 */
+	const char *data() const {
+		return buffer_.data() + begin_;
+	}
+
+	size_t size() const {
+		return end_ - begin_;
+	}
+
+	/**
+	 * @brief 可写入位置,调用前应先调用prepare
+	 * @param
+	 * @return char*
+	 */
+	char *write_data() {
+		return buffer_.data() + end_;
+	}
+
+	size_t write_size() const {
+		return buffer_.size() - end_;
+	}
+
+	/**
+	 * @brief 保证尾部至少有空间可写,并且能容纳长度为frame_length的整帧
+	 * @param frame_length 当前半帧的总长度,未知时传0
+	 * @return
+	 */
+	void prepare(size_t frame_length = 0) {
+		if (frame_length > buffer_.size()) {
+			compact();
+			buffer_.resize(frame_length);
+		}
+		else if (end_ == buffer_.size() || (frame_length && begin_ + frame_length > buffer_.size())) {
+			compact();
+		}
+	}
+
+	/**
+	 * @brief 标记n字节已写入
+	 * @param n 字节数
+	 * @return
+	 */
+	void commit(size_t n) {
+		end_ += n;
+	}
+
+	/**
+	 * @brief 消费n字节已解析的数据
+	 * @param n 字节数
+	 * @return
+	 */
+	void consume(size_t n) {
+		begin_ += n;
+		if (begin_ == end_) {
+			begin_ = end_ = 0;
+			if (buffer_.size() > initial_capacity_) {
+				buffer_.resize(initial_capacity_);
+				buffer_.shrink_to_fit();
+			}
+		}
+	}
+
+private:
+	/**
+	 * @brief 将未解析的数据搬到缓冲区头部
+	 * @param
+	 * @return
+	 */
+	void compact() {
+		if (begin_ == 0)
+			return;
+		memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+		end_ -= begin_;
+		begin_ = 0;
+	}
+
+private:
+	std::vector<char> buffer_;
+	size_t initial_capacity_;
+	size_t begin_ = 0;
+	size_t end_ = 0;
+};
+
+/**
+ * @brief 从接收缓冲区中解析出所有完整的Header+body帧,每帧调用一次handler(type, body, body_length)
+ *        末尾不完整的帧留在缓冲区中,并为其预留空间
+ * @param buffer 接收缓冲区
+ * @param handler 帧处理函数
+ * @return int 解析出的帧数,消息头非法时返回-1
+ */
+template <typename Handler>
+int parse_frames(receive_buffer &buffer, Handler &&handler) {
+	int frames = 0;
+	size_t pending = 0;
+	while (buffer.size() >= chat_message::header_length) {
+		Header header;
+		memcpy(&header, buffer.data(), chat_message::header_length);
+		if (header.body_size_ < 0 || size_t(header.body_size_) > chat_message::max_body_length())
+			return -1;
+		size_t frame_length = chat_message::header_length + header.body_size_;
+		if (buffer.size() < frame_length) {
+			pending = frame_length;
+			break;
+		}
+		handler(header.type_, buffer.data() + chat_message::header_length, size_t(header.body_size_));
+		buffer.consume(frame_length);
+		++frames;
+	}
+	buffer.prepare(pending);
+	return frames;
+}
@@ -0,0 +1,651 @@
+﻿#include "room_log.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace fs = boost::filesystem;
+namespace bip = boost::interprocess;
+
+namespace {
+
+/**
+ * @brief 日志记录头,后面紧跟消息帧(消息头+消息体),整条记录按8字节对齐
+ */
+struct record_header {
+	//消息帧长度
+	uint32_t length;
+	uint32_t checksum;
+	uint64_t seq;
+	//写入时间,毫秒
+	int64_t time_ms;
+};
+
+/**
+ * @brief 稀疏索引项,索引文件就是这些项的数组
+ */
+struct index_entry {
+	uint64_t seq;
+	uint64_t offset;
+};
+
+size_t record_size(size_t length) {
+	return (sizeof(record_header) + length + 7) & ~size_t(7);
+}
+
+/**
+ * @brief 记录校验和(FNV-1a),只用来识别崩溃时写了一半的记录
+ * @param header 记录头,checksum字段不参与计算
+ * @param frame 消息帧
+ * @return uint32_t
+ */
+uint32_t record_checksum(const record_header &header, const char *frame) {
+	uint32_t h = 2166136261u;
+	auto mix = [&h](const void *data, size_t size) {
+		auto bytes = static_cast<const unsigned char *>(data);
+		for (size_t i = 0; i < size; ++i) {
+			h ^= bytes[i];
+			h *= 16777619u;
+		}
+	};
+	mix(&header.length, sizeof(header.length));
+	mix(&header.seq, sizeof(header.seq));
+	mix(&header.time_ms, sizeof(header.time_ms));
+	mix(frame, header.length);
+	return h;
+}
+
+int64_t now_ms() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief 进程内已打开的日志,按目录索引
+ */
+struct open_logs {
+	static open_logs &instance() {
+		static open_logs table;
+		return table;
+	}
+
+	std::mutex mutex;
+	//日志对象释放完成后才移除,期间再次打开的一方等待closed
+	std::unordered_map<std::string, std::weak_ptr<room_log>> logs;
+	std::condition_variable closed;
+};
+
+std::string segment_name(uint64_t base_seq, const char *extension) {
+	char name[32];
+	snprintf(name, sizeof(name), "%020llu%s", static_cast<unsigned long long>(base_seq), extension);
+	return name;
+}
+
+}
+
+/**
+ * @brief 一个段文件及其映射,记录只追加,size之前的内容写入后不再修改,
+ *        可以在锁外读取;size、next_seq、index等字段由room_log的互斥锁保护
+ */
+struct room_log::segment {
+	~segment() {
+		index_file.close();
+		bip::mapped_region().swap(region);
+		bip::file_mapping().swap(file);
+		boost::system::error_code ec;
+		if (remove_on_close) {
+			fs::remove(path, ec);
+			fs::remove(index_path, ec);
+		}
+		else if (writable && size < capacity) {
+			//截掉预分配但没有用到的空间,重新打开时只需扫描到文件末尾
+			fs::resize_file(path, size, ec);
+		}
+	}
+
+	const char *data() const {
+		return static_cast<const char *>(region.get_address());
+	}
+
+	char *data() {
+		return static_cast<char *>(region.get_address());
+	}
+
+	/**
+	 * @brief 校验offset处的记录
+	 * @param offset 记录偏移
+	 * @param seq 期望的序号
+	 * @param header 输出的记录头
+	 * @return bool 是否为完整的记录
+	 */
+	bool valid_record(size_t offset, uint64_t seq, record_header &header) const {
+		if (offset + sizeof(record_header) > capacity)
+			return false;
+		memcpy(&header, data() + offset, sizeof(header));
+		return header.seq == seq && header.length >= chat_message::header_length &&
+			   offset + record_size(header.length) <= capacity &&
+			   header.checksum == record_checksum(header, data() + offset + sizeof(header));
+	}
+
+	/**
+	 * @brief 按序号找记录的偏移,先二分稀疏索引再顺序扫描,调用时需持有锁
+	 * @param seq 序号,必须在[base_seq, next_seq)中
+	 * @return size_t 记录偏移
+	 */
+	size_t locate(uint64_t seq) const {
+		auto it = std::upper_bound(index.begin(), index.end(), seq,
+			[](uint64_t s, const index_entry &e) { return s < e.seq; });
+		size_t offset = 0;
+		uint64_t current = base_seq;
+		if (it != index.begin()) {
+			--it;
+			offset = size_t(it->offset);
+			current = it->seq;
+		}
+		record_header header;
+		for (; current < seq; ++current) {
+			memcpy(&header, data() + offset, sizeof(header));
+			offset += record_size(header.length);
+		}
+		return offset;
+	}
+
+	uint64_t base_seq = 0;
+	uint64_t next_seq = 0;
+	std::string path;
+	std::string index_path;
+	bip::file_mapping file;
+	bip::mapped_region region;
+	size_t capacity = 0;
+	//已写入的字节数
+	size_t size = 0;
+	//已落盘的字节数
+	size_t synced = 0;
+	int64_t first_time_ms = 0;
+	int64_t last_time_ms = 0;
+	std::vector<index_entry> index;
+	std::ofstream index_file;
+	//以读写方式映射,关闭时截掉预分配的空间
+	bool writable = false;
+	//已被保留策略删除或被压缩后的段替代,最后一个引用释放时删除文件
+	bool remove_on_close = false;
+};
+
+room_log::room_log(const room_log_options &options, const std::string &dir)
+	: options_(options), dir_(dir) {
+}
+
+room_log::~room_log() {
+	sync();
+}
+
+/**
+ * @brief 打开房间的日志,目录或段文件不存在时创建,已有的段会被恢复,
+ *        末尾写了一半的记录被丢弃
+ * @param options 日志参数
+ * @param room_id 房间id
+ * @return std::shared_ptr<room_log> 失败时输出原因并返回nullptr
+ */
+std::shared_ptr<room_log> room_log::open(const room_log_options &options, uint64_t room_id) {
+	auto dir = (fs::path(options.dir) / ("room-" + std::to_string(room_id))).string();
+	auto &table = open_logs::instance();
+	std::unique_lock<std::mutex> table_lock(table.mutex);
+	//房间回收后很快又被创建时,旧房间的日志可能还被落盘任务引用,继续使用同一个对象;
+	//旧日志正在关闭时等它关闭完成,同一目录的段文件不会同时被两个对象映射
+	for (;;) {
+		auto it = table.logs.find(dir);
+		if (it == table.logs.end())
+			break;
+		if (auto log = it->second.lock())
+			return log;
+		table.closed.wait(table_lock);
+	}
+
+	try {
+		fs::create_directories(dir);
+		std::unique_ptr<room_log> log(new room_log(options, dir));
+
+		std::vector<uint64_t> bases;
+		std::vector<fs::path> stale;
+		for (fs::directory_iterator it(dir), end; it != end; ++it) {
+			//压缩中途崩溃留下的临时文件
+			if (it->path().extension() == ".tmp")
+				stale.push_back(it->path());
+			if (it->path().extension() != ".log")
+				continue;
+			auto stem = it->path().stem().string();
+			char *stop = nullptr;
+			auto base = strtoull(stem.c_str(), &stop, 10);
+			if (!stem.empty() && *stop == '\0')
+				bases.push_back(base);
+		}
+		for (const auto &path : stale)
+			fs::remove(path);
+		std::sort(bases.begin(), bases.end());
+
+		for (size_t i = 0; i < bases.size(); ++i) {
+			bool last = i + 1 == bases.size();
+			auto s = log->load_segment(bases[i], last);
+			if (!s)
+				continue;
+			//压缩后的段改名生效但旧段还没删除时两者重叠,以压缩后的段为准
+			while (!log->segments_.empty() && log->segments_.back()->next_seq > s->base_seq) {
+				log->total_bytes_ -= log->segments_.back()->size;
+				log->segments_.back()->remove_on_close = true;
+				log->segments_.pop_back();
+			}
+			log->total_bytes_ += s->size;
+			log->segments_.push_back(std::move(s));
+		}
+
+		if (log->segments_.empty() || !log->segments_.back()->writable) {
+			//序号从1开始,0表示没有记录
+			uint64_t next = log->segments_.empty() ? 1 : log->segments_.back()->next_seq;
+			auto s = log->create_segment(next, options.segment_bytes);
+			if (!s)
+				return nullptr;
+			log->segments_.push_back(std::move(s));
+		}
+
+		std::shared_ptr<room_log> shared(log.release(), [dir](room_log *p) {
+			delete p;
+			auto &table = open_logs::instance();
+			std::lock_guard<std::mutex> lock(table.mutex);
+			table.logs.erase(dir);
+			table.closed.notify_all();
+		});
+		table.logs[dir] = shared;
+		return shared;
+	}
+	catch (const std::exception &e) {
+		std::cerr << "room " << room_id << " log " << dir << ": " << e.what() << std::endl;
+		return nullptr;
+	}
+}
+
+/**
+ * @brief 追加一条消息帧
+ * @param msg 编码好的消息帧
+ * @return uint64_t 记录的序号,写入失败时返回0
+ */
+uint64_t room_log::append(const chat_message &msg) {
+	size_t length = msg.length();
+	size_t bytes = record_size(length);
+	if (bytes > options_.segment_bytes)
+		return 0;
+
+	//只有append修改最后一个段的内容和段列表的末尾,maintain可能同时删除列表头部的段
+	segment_ptr active;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		active = segments_.back();
+	}
+	if (active->size + bytes > active->capacity) {
+		auto next = create_segment(active->next_seq, options_.segment_bytes);
+		if (!next)
+			return 0;
+		std::lock_guard<std::mutex> lock(mutex_);
+		segments_.push_back(next);
+		active = next;
+	}
+
+	record_header header;
+	header.length = uint32_t(length);
+	header.seq = active->next_seq;
+	header.time_ms = now_ms();
+	header.checksum = record_checksum(header, msg.data());
+	size_t offset = active->size;
+	char *p = active->data() + offset;
+	memcpy(p, &header, sizeof(header));
+	memcpy(p + sizeof(header), msg.data(), length);
+
+	bool indexed = active->index.empty() ||
+				   offset - size_t(active->index.back().offset) >= options_.index_interval_bytes;
+	{
+		//记录内容写完后再发布长度,读者看到的长度之内都是完整的记录
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (indexed)
+			active->index.push_back(index_entry{ header.seq, offset });
+		if (active->size == 0)
+			active->first_time_ms = header.time_ms;
+		active->last_time_ms = header.time_ms;
+		active->size += bytes;
+		active->next_seq = header.seq + 1;
+		total_bytes_ += bytes;
+	}
+	if (indexed) {
+		active->index_file.write(reinterpret_cast<const char *>(&active->index.back()), sizeof(index_entry));
+		active->index_file.flush();
+	}
+	return header.seq;
+}
+
+/**
+ * @brief 最早一条仍保留的记录的序号
+ * @param
+ * @return uint64_t
+ */
+uint64_t room_log::first_seq() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return segments_.front()->base_seq;
+}
+
+/**
+ * @brief 下一条记录的序号,即最后一条记录的序号加一
+ * @param
+ * @return uint64_t
+ */
+uint64_t room_log::next_seq() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return segments_.back()->next_seq;
+}
+
+/**
+ * @brief 读取[from, to)范围内的记录,范围会被截断到仍保留的记录
+ * @param from 起始序号
+ * @param to 结束序号(不含)
+ * @return chat_message_batch_ptr 按序号排列的消息帧,没有记录时返回nullptr
+ */
+chat_message_batch_ptr room_log::read(uint64_t from, uint64_t to) const {
+	struct range {
+		segment_ptr s;
+		size_t offset;
+		size_t end;
+	};
+	std::vector<range> ranges;
+	{
+		//锁内只定位每个段的起止偏移,拷贝在锁外进行
+		std::lock_guard<std::mutex> lock(mutex_);
+		from = std::max(from, segments_.front()->base_seq);
+		to = std::min(to, segments_.back()->next_seq);
+		if (from >= to)
+			return nullptr;
+		for (const auto &s : segments_) {
+			if (s->next_seq <= from || s->base_seq >= to || s->size == 0)
+				continue;
+			size_t offset = s->locate(std::max(from, s->base_seq));
+			size_t end = s->next_seq <= to ? s->size : s->locate(to);
+			ranges.push_back(range{ s, offset, end });
+		}
+	}
+
+	auto batch = std::make_shared<chat_message_batch>();
+	batch->reserve(size_t(to - from));
+	for (const auto &r : ranges) {
+		record_header header;
+		for (size_t offset = r.offset; offset < r.end; offset += record_size(header.length)) {
+			memcpy(&header, r.s->data() + offset, sizeof(header));
+			const char *frame = r.s->data() + offset + sizeof(header);
+			auto msg = std::make_shared<chat_message>();
+			memcpy(msg->data(), frame, chat_message::header_length);
+			//消息体上限可能在重启时被调小,超出上限的记录跳过
+			if (!msg->decode_header() || msg->length() != header.length)
+				continue;
+			memcpy(msg->body(), frame + chat_message::header_length, msg->body_length());
+			batch->push_back(std::move(msg));
+		}
+	}
+	if (batch->empty())
+		return nullptr;
+	return batch;
+}
+
+/**
+ * @brief 把尚未落盘的记录fsync到磁盘,上一次sync之后的所有追加合并为一次
+ * @param
+ * @return size_t 本次落盘的字节数
+ */
+size_t room_log::sync() {
+	struct range {
+		segment_ptr s;
+		size_t begin;
+		size_t end;
+	};
+	std::vector<range> ranges;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (const auto &s : segments_) {
+			if (s->writable && s->synced < s->size)
+				ranges.push_back(range{ s, s->synced, s->size });
+		}
+	}
+
+	//已写入的部分不会再被修改,可以在锁外落盘,期间的追加留给下一次
+	size_t bytes = 0;
+	size_t page = bip::mapped_region::get_page_size();
+	for (const auto &r : ranges) {
+		size_t begin = r.begin / page * page;
+		r.s->region.flush(begin, r.end - begin, false);
+		bytes += r.end - r.begin;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (const auto &r : ranges)
+		r.s->synced = std::max(r.s->synced, r.end);
+	return bytes;
+}
+
+/**
+ * @brief 按保留策略删除过期的段,并在需要时压缩最早的段
+ * @param
+ * @return
+ */
+void room_log::maintain() {
+	//落盘任务之间可能重叠,同一时间只有一个在执行保留和压缩
+	if (maintaining_.exchange(true))
+		return;
+	apply_retention();
+	maintaining_ = false;
+}
+
+/**
+ * @brief 删除超出保留策略的段,最早的段有一半以上过期时重写它,只在maintain中调用
+ * @param
+ * @return
+ */
+void room_log::apply_retention() {
+	int64_t expire_before = options_.retention_seconds > 0 ?
+		now_ms() - options_.retention_seconds * 1000 : std::numeric_limits<int64_t>::min();
+	segment_ptr oldest;
+	{
+		//正在写入的最后一个段不删除
+		std::lock_guard<std::mutex> lock(mutex_);
+		while (segments_.size() > 1) {
+			auto &front = segments_.front();
+			bool over_size = options_.retention_bytes > 0 && total_bytes_ > options_.retention_bytes;
+			if (!over_size && front->last_time_ms >= expire_before)
+				break;
+			total_bytes_ -= front->size;
+			front->remove_on_close = true;
+			segments_.erase(segments_.begin());
+		}
+		if (options_.compact && segments_.size() > 1 && segments_.front()->first_time_ms < expire_before)
+			oldest = segments_.front();
+	}
+	if (!oldest)
+		return;
+
+	//找到第一条未过期的记录,过期部分不到一半时不值得重写
+	size_t offset = 0;
+	uint64_t keep_from = oldest->base_seq;
+	record_header header;
+	while (offset < oldest->size) {
+		memcpy(&header, oldest->data() + offset, sizeof(header));
+		if (header.time_ms >= expire_before)
+			break;
+		offset += record_size(header.length);
+		++keep_from;
+	}
+	if (offset * 2 < oldest->size || keep_from >= oldest->next_seq)
+		return;
+
+	auto compacted = rewrite_segment(oldest, keep_from);
+	if (!compacted)
+		return;
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (segments_.size() > 1 && segments_.front() == oldest) {
+		total_bytes_ -= oldest->size;
+		total_bytes_ += compacted->size;
+		oldest->remove_on_close = true;
+		segments_.front() = std::move(compacted);
+	}
+	else {
+		compacted->remove_on_close = true;
+	}
+}
+
+/**
+ * @brief 创建一个新段并映射
+ * @param base_seq 段中第一条记录的序号
+ * @param capacity 段文件大小
+ * @return segment_ptr 失败时输出原因并返回nullptr
+ */
+room_log::segment_ptr room_log::create_segment(uint64_t base_seq, size_t capacity) const {
+	auto s = std::make_shared<segment>();
+	s->base_seq = base_seq;
+	s->next_seq = base_seq;
+	s->path = (fs::path(dir_) / segment_name(base_seq, ".log")).string();
+	s->index_path = (fs::path(dir_) / segment_name(base_seq, ".idx")).string();
+	try {
+		{
+			std::ofstream create(s->path, std::ios::binary | std::ios::trunc);
+		}
+		fs::resize_file(s->path, capacity);
+		bip::file_mapping(s->path.c_str(), bip::read_write).swap(s->file);
+		bip::mapped_region(s->file, bip::read_write, 0, capacity).swap(s->region);
+		s->capacity = capacity;
+		s->writable = true;
+		s->index_file.open(s->index_path, std::ios::binary | std::ios::trunc);
+		return s;
+	}
+	catch (const std::exception &e) {
+		std::cerr << "log segment " << s->path << ": " << e.what() << std::endl;
+		boost::system::error_code ec;
+		fs::remove(s->path, ec);
+		return nullptr;
+	}
+}
+
+/**
+ * @brief 映射一个已有的段,从最后一个有效的索引项开始扫描找到末尾,并补全其后的索引
+ * @param base_seq 段中第一条记录的序号
+ * @param writable 是否为继续写入的最后一个段
+ * @return segment_ptr 段为空且不是最后一个段时删除并返回nullptr
+ */
+room_log::segment_ptr room_log::load_segment(uint64_t base_seq, bool writable) const {
+	auto s = std::make_shared<segment>();
+	s->base_seq = base_seq;
+	s->path = (fs::path(dir_) / segment_name(base_seq, ".log")).string();
+	s->index_path = (fs::path(dir_) / segment_name(base_seq, ".idx")).string();
+	size_t file_size = size_t(fs::file_size(s->path));
+	if (writable && file_size < options_.segment_bytes) {
+		fs::resize_file(s->path, options_.segment_bytes);
+		file_size = options_.segment_bytes;
+	}
+	if (file_size == 0) {
+		s->remove_on_close = true;
+		return nullptr;
+	}
+	auto mode = writable ? bip::read_write : bip::read_only;
+	bip::file_mapping(s->path.c_str(), mode).swap(s->file);
+	bip::mapped_region(s->file, mode, 0, file_size).swap(s->region);
+	s->capacity = file_size;
+	s->writable = writable;
+
+	std::ifstream index_in(s->index_path, std::ios::binary);
+	index_entry entry;
+	while (index_in.read(reinterpret_cast<char *>(&entry), sizeof(entry))) {
+		bool increasing = s->index.empty() ||
+						  (entry.seq > s->index.back().seq && entry.offset > s->index.back().offset);
+		if (!increasing || entry.seq < base_seq || entry.offset >= file_size)
+			break;
+		s->index.push_back(entry);
+	}
+	index_in.close();
+
+	//索引文件可能比段文件新(崩溃前索引已落盘而记录没有),丢掉指向无效记录的索引项
+	record_header header;
+	while (!s->index.empty() && !s->valid_record(size_t(s->index.back().offset), s->index.back().seq, header))
+		s->index.pop_back();
+	size_t loaded = s->index.size();
+
+	size_t offset = s->index.empty() ? 0 : size_t(s->index.back().offset);
+	uint64_t seq = s->index.empty() ? base_seq : s->index.back().seq;
+	while (s->valid_record(offset, seq, header)) {
+		if (s->index.empty() || offset - size_t(s->index.back().offset) >= options_.index_interval_bytes)
+			s->index.push_back(index_entry{ seq, offset });
+		s->last_time_ms = header.time_ms;
+		offset += record_size(header.length);
+		++seq;
+	}
+	s->size = offset;
+	s->synced = offset;
+	s->next_seq = seq;
+	if (offset > 0) {
+		memcpy(&header, s->data(), sizeof(header));
+		s->first_time_ms = header.time_ms;
+	}
+	else if (!writable) {
+		s->remove_on_close = true;
+		return nullptr;
+	}
+
+	//扫描补全了索引时重写索引文件,下次打开不必再扫描
+	if (loaded != s->index.size()) {
+		std::ofstream index_out(s->index_path, std::ios::binary | std::ios::trunc);
+		index_out.write(reinterpret_cast<const char *>(s->index.data()), s->index.size() * sizeof(index_entry));
+	}
+	if (writable)
+		s->index_file.open(s->index_path, std::ios::binary | std::ios::app);
+	return s;
+}
+
+/**
+ * @brief 重写一个段,只保留序号不小于keep_from的记录,先写到临时文件,
+ *        落盘后改名为以keep_from命名的段,再以只读方式重新映射
+ * @param old 原来的段
+ * @param keep_from 保留的第一条记录的序号
+ * @return segment_ptr 失败时返回nullptr
+ */
+room_log::segment_ptr room_log::rewrite_segment(const segment_ptr &old, uint64_t keep_from) const {
+	std::string tmp_path;
+	try {
+		size_t begin;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			begin = old->locate(keep_from);
+		}
+		size_t bytes = old->size - begin;
+		auto path = (fs::path(dir_) / segment_name(keep_from, ".log")).string();
+		tmp_path = path + ".tmp";
+		{
+			std::ofstream create(tmp_path, std::ios::binary | std::ios::trunc);
+		}
+		fs::resize_file(tmp_path, bytes);
+		{
+			//记录中的偏移都是段内相对位置之外的信息,可以原样整体拷贝
+			bip::file_mapping file(tmp_path.c_str(), bip::read_write);
+			bip::mapped_region region(file, bip::read_write, 0, bytes);
+			memcpy(region.get_address(), old->data() + begin, bytes);
+			region.flush(0, bytes, false);
+		}
+		fs::rename(tmp_path, path);
+		return load_segment(keep_from, false);
+	}
+	catch (const std::exception &e) {
+		std::cerr << "log compaction " << old->path << ": " << e.what() << std::endl;
+		boost::system::error_code ec;
+		if (!tmp_path.empty())
+			fs::remove(tmp_path, ec);
+		return nullptr;
+	}
+}
@@ -0,0 +1,146 @@
+﻿#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "chat_history.h"
+
+/**
+ * @brief 房间消息日志参数
+ */
+struct room_log_options {
+	//日志根目录,每个房间一个子目录,为空表示不持久化
+	std::string dir;
+	//单个段文件的大小,写满后切换到新段
+	size_t segment_bytes = 16 * 1024 * 1024;
+	//稀疏索引的间隔,每写入这么多字节记一个索引项
+	size_t index_interval_bytes = 4096;
+	//批量fsync的间隔(毫秒),0表示交给操作系统回写
+	int fsync_interval_ms = 200;
+	//每个房间保留的字节数上限,0表示不限,超出时删除最早的段
+	uint64_t retention_bytes = 0;
+	//消息保留时长(秒),0表示不限,段中最新的消息过期后删除整段
+	int64_t retention_seconds = 0;
+	//最早的段有一半以上的消息过期时重写该段,只保留未过期的部分
+	bool compact = true;
+};
+
+/**
+ * @brief 一个房间的只追加消息日志,分成多个内存映射的段文件,
+ *        每条记录有递增的序号,段内每隔index_interval_bytes记一个稀疏索引项(序号->偏移),
+ *        按序号读取时先二分索引再顺序扫描,追赶读取是对映射内存的顺序拷贝
+ *        append只能由一个线程(房间的strand)调用;读取、sync和maintain可以在任意线程调用,
+ *        互斥锁只保护段列表和各段的长度,记录内容的拷贝在锁外进行
+ */
+class room_log {
+public:
+	/**
+	 * @brief 打开房间的日志,目录或段文件不存在时创建,已有的段会被恢复,
+	 *        末尾写了一半的记录被丢弃
+	 * @param options 日志参数
+	 * @param room_id 房间id
+	 * @return std::shared_ptr<room_log> 失败时输出原因并返回nullptr
+	 */
+	static std::shared_ptr<room_log> open(const room_log_options &options, uint64_t room_id);
+
+	~room_log();
+
+	room_log(const room_log &) = delete;
+	room_log &operator=(const room_log &) = delete;
+
+	/**
+	 * @brief 追加一条消息帧
+	 * @param msg 编码好的消息帧
+	 * @return uint64_t 记录的序号,写入失败时返回0
+	 */
+	uint64_t append(const chat_message &msg);
+
+	/**
+	 * @brief 最早一条仍保留的记录的序号
+	 * @param
+	 * @return uint64_t
+	 */
+	uint64_t first_seq() const;
+
+	/**
+	 * @brief 下一条记录的序号,即最后一条记录的序号加一
+	 * @param
+	 * @return uint64_t
+	 */
+	uint64_t next_seq() const;
+
+	/**
+	 * @brief 读取[from, to)范围内的记录,范围会被截断到仍保留的记录
+	 * @param from 起始序号
+	 * @param to 结束序号(不含)
+	 * @return chat_message_batch_ptr 按序号排列的消息帧,没有记录时返回nullptr
+	 */
+	chat_message_batch_ptr read(uint64_t from, uint64_t to) const;
+
+	/**
+	 * @brief 把尚未落盘的记录fsync到磁盘,上一次sync之后的所有追加合并为一次
+	 * @param
+	 * @return size_t 本次落盘的字节数
+	 */
+	size_t sync();
+
+	/**
+	 * @brief 按保留策略删除过期的段,并在需要时压缩最早的段
+	 * @param
+	 * @return
+	 */
+	void maintain();
+
+	const room_log_options &options() const {
+		return options_;
+	}
+
+private:
+	struct segment;
+	using segment_ptr = std::shared_ptr<segment>;
+
+	room_log(const room_log_options &options, const std::string &dir);
+
+	/**
+	 * @brief 删除超出保留策略的段,最早的段有一半以上过期时重写它,只在maintain中调用
+	 * @param
+	 * @return
+	 */
+	void apply_retention();
+
+	/**
+	 * @brief 创建一个新段并映射
+	 * @param base_seq 段中第一条记录的序号
+	 * @param capacity 段文件大小
+	 * @return segment_ptr 失败时输出原因并返回nullptr
+	 */
+	segment_ptr create_segment(uint64_t base_seq, size_t capacity) const;
+
+	/**
+	 * @brief 映射一个已有的段,从最后一个有效的索引项开始扫描找到末尾,并补全其后的索引
+	 * @param base_seq 段中第一条记录的序号
+	 * @param writable 是否为继续写入的最后一个段
+	 * @return segment_ptr 段为空且不是最后一个段时删除并返回nullptr
+	 */
+	segment_ptr load_segment(uint64_t base_seq, bool writable) const;
+
+	/**
+	 * @brief 重写一个段,只保留序号不小于keep_from的记录
+	 * @param old 原来的段
+	 * @param keep_from 保留的第一条记录的序号
+	 * @return segment_ptr 失败时返回nullptr
+	 */
+	segment_ptr rewrite_segment(const segment_ptr &old, uint64_t keep_from) const;
+
+private:
+	room_log_options options_;
+	std::string dir_;
+	mutable std::mutex mutex_;
+	//按序号排列的段,最后一个是正在写入的段
+	std::vector<segment_ptr> segments_;
+	//所有段的总字节数
+	uint64_t total_bytes_ = 0;
+	std::atomic<bool> maintaining_{ false };
+};
@@ -0,0 +1,89 @@
+﻿#include "room_registry.h"
+#include "server_stats.h"
+
+/**
+ * @brief 构造
+ * @param services 分片所在的io_service,分片i使用services[i % services.size()]
+ * @param shard_num 分片数,0表示每个io_service一个分片
+ * @param options 新建房间的参数,fanout_partitions为0时使用分片数
+ * @return 本类对象
+ */
+room_registry::room_registry(const std::vector<boost::asio::io_service *> &services, size_t shard_num,
+							 const room_options &options)
+	: services_(services), options_(options) {
+	if (shard_num == 0)
+		shard_num = services.size();
+	for (size_t i = 0; i < shard_num; ++i)
+		shards_.emplace_back(new shard(*services[i % services.size()]));
+	if (options_.fanout_partitions == 0)
+		options_.fanout_partitions = int(shards_.size());
+}
+
+/**
+ * @brief 加入房间,房间不存在时创建
+ * @param room_id 房间id
+ * @param cp 客户端智能指针
+ * @param last_seq 客户端在该房间最后收到的序号,0表示重放全部历史
+ * @return
+ */
+void room_registry::join(uint64_t room_id, const chat_participant_ptr &cp, uint64_t last_seq) {
+	auto &s = shard_of(room_id);
+	s.strand.post([this, &s, room_id, cp, last_seq] {
+		auto &room = s.rooms[room_id];
+		if (!room) {
+			room = std::make_shared<chat_room>(s.io_service, s.strand, room_id, options_, services_);
+			//最后一个成员离开后的快照发布时回调,此时没有排队或未应用的加入
+			room->set_empty_handler([this, &s, room_id] {
+				s.rooms.erase(room_id);
+				if (cluster_)
+					cluster_->unsubscribe(room_id);
+				server_stats::instance().record_room_reclaimed();
+			});
+			if (cluster_)
+				cluster_->subscribe(room_id);
+			server_stats::instance().record_room_created();
+		}
+		room->join(cp, last_seq);
+	});
+}
+
+/**
+ * @brief 离开房间,房间变空后在成员快照发布时回收
+ * @param room_id 房间id
+ * @param cp 客户端智能指针
+ * @return
+ */
+void room_registry::leave(uint64_t room_id, const chat_participant_ptr &cp) {
+	auto &s = shard_of(room_id);
+	s.strand.post([&s, room_id, cp] {
+		auto it = s.rooms.find(room_id);
+		if (it == s.rooms.end())
+			return;
+		it->second->leave(cp);
+	});
+}
+
+/**
+ * @brief 向房间广播,房间不存在时丢弃
+ * @param room_id 房间id
+ * @param msg 编码好的消息帧,由房间写入序号
+ * @param relay 是否转发给集群中的其他节点,其他节点转发来的消息不再转发
+ * @return
+ */
+void room_registry::deliver(uint64_t room_id, const std::shared_ptr<chat_message> &msg, bool relay) {
+	//房间会原地写入序号,转发在投递到房间之前编码,各节点的房间各自编号
+	if (relay && cluster_)
+		cluster_->relay(room_id, *msg);
+	auto &s = shard_of(room_id);
+	s.strand.post([&s, room_id, msg] {
+		auto it = s.rooms.find(room_id);
+		if (it != s.rooms.end())
+			it->second->deliver(msg);
+	});
+}
+
+room_registry::shard &room_registry::shard_of(uint64_t room_id) {
+	//乘法哈希,连续的房间id也能均匀分布
+	uint64_t h = room_id * 0x9E3779B97F4A7C15ull;
+	return *shards_[(h >> 32) % shards_.size()];
+}
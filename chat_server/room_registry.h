@@ -0,0 +1,99 @@
+﻿#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio.hpp>
+#include "chat_room.h"
+#include "cluster_node.h"
+
+/**
+ * @brief 按房间id索引的房间表,分成多个分片,每个分片一个strand和一张房间表,
+ *        房间由id的哈希固定到一个分片,不同分片的房间不会共用strand
+ *        房间在第一个客户端加入时创建,最后一个客户端离开时回收
+ *        组成集群时,房间创建和回收时向其他节点订阅和退订,本地客户端的广播同时转发给订阅的节点
+ */
+class room_registry {
+public:
+	//连接建立后自动加入的大厅,兼容只有一个房间时的MT_CHAT_INFO
+	enum : uint64_t { lobby_room_id = 0 };
+
+	/**
+	 * @brief 构造
+	 * @param services 分片所在的io_service,分片i使用services[i % services.size()]
+	 * @param shard_num 分片数,0表示每个io_service一个分片
+	 * @param options 新建房间的参数,fanout_partitions为0时使用分片数
+	 * @return 本类对象
+	 */
+	room_registry(const std::vector<boost::asio::io_service *> &services, size_t shard_num,
+				  const room_options &options = room_options());
+
+	room_registry(const room_registry &) = delete;
+	room_registry &operator=(const room_registry &) = delete;
+
+	/**
+	 * @brief 加入房间,房间不存在时创建
+	 * @param room_id 房间id
+	 * @param cp 客户端智能指针
+	 * @param last_seq 客户端在该房间最后收到的序号,0表示重放全部历史
+	 * @return
+	 */
+	void join(uint64_t room_id, const chat_participant_ptr &cp, uint64_t last_seq = 0);
+
+	/**
+	 * @brief 离开房间,房间变空后在成员快照发布时回收
+	 * @param room_id 房间id
+	 * @param cp 客户端智能指针
+	 * @return
+	 */
+	void leave(uint64_t room_id, const chat_participant_ptr &cp);
+
+	/**
+	 * @brief 向房间广播,房间不存在时丢弃
+	 * @param room_id 房间id
+	 * @param msg 编码好的消息帧,由房间写入序号
+	 * @param relay 是否转发给集群中的其他节点,其他节点转发来的消息不再转发
+	 * @return
+	 */
+	void deliver(uint64_t room_id, const std::shared_ptr<chat_message> &msg, bool relay = true);
+
+	/**
+	 * @brief 加入集群,需在有客户端连接之前设置
+	 * @param cluster 本节点,为nullptr时不转发
+	 * @return
+	 */
+	void set_cluster(cluster_node *cluster) {
+		cluster_ = cluster;
+	}
+
+	size_t shard_count() const {
+		return shards_.size();
+	}
+
+	const room_options &options() const {
+		return options_;
+	}
+
+private:
+	/**
+	 * @brief 一个分片,rooms只在strand中访问
+	 */
+	struct shard {
+		explicit shard(boost::asio::io_service &io_service)
+			: io_service(io_service), strand(io_service) {
+		}
+
+		boost::asio::io_service &io_service;
+		boost::asio::io_service::strand strand;
+		std::unordered_map<uint64_t, std::shared_ptr<chat_room>> rooms;
+	};
+
+	shard &shard_of(uint64_t room_id);
+
+private:
+	std::vector<std::unique_ptr<shard>> shards_;
+	//大房间并行广播的分区所在的io_service
+	std::vector<boost::asio::io_service *> services_;
+	room_options options_;
+	cluster_node *cluster_ = nullptr;
+};
@@ -0,0 +1,156 @@
+﻿#pragma once
+#include <deque>
+#include <string>
+#include "chat_room.h"
+#include "server_stats.h"
+
+/**
+ * @brief 发送队列满时的处理方式
+ */
+enum class overflow_policy {
+	drop_oldest,	//丢弃最早的未发送消息
+	drop_newest,	//丢弃新到的消息
+	disconnect,		//断开慢客户端
+};
+
+/**
+ * @brief 每个连接的发送队列上限,0表示不限制
+ */
+struct send_queue_options {
+	size_t max_msgs = 0;
+	size_t max_bytes = 0;
+	overflow_policy policy = overflow_policy::drop_oldest;
+};
+
+/**
+ * @brief 按名字解析overflow_policy
+ * @param name drop-oldest/drop-newest/disconnect
+ * @param policy 输出
+ * @return bool 是否解析成功
+ */
+inline bool parse_overflow_policy(const std::string &name, overflow_policy &policy) {
+	if (name == "drop-oldest")
+		policy = overflow_policy::drop_oldest;
+	else if (name == "drop-newest")
+		policy = overflow_policy::drop_newest;
+	else if (name == "disconnect")
+		policy = overflow_policy::disconnect;
+	else
+		return false;
+	return true;
+}
+
+/**
+ * @brief 有上限的发送队列,按条数和字节数限制,超限时按策略丢弃或要求断开
+ *        队首in_flight条消息正在写入socket,不会被丢弃
+ */
+class send_queue {
+public:
+	using const_iterator = chat_message_queue::const_iterator;
+
+	explicit send_queue(const send_queue_options &options = send_queue_options())
+		: options_(options) {
+	}
+
+	/**
+	 * @brief 追加一条消息,超限时按策略处理
+	 * @param msg 编码好的共享消息帧
+	 * @return bool false表示应断开该连接
+	 */
+	bool push(const chat_message_ptr &msg) {
+		if (!over_limit(1, msg->length())) {
+			append(msg);
+			return true;
+		}
+
+		auto &stats = server_stats::instance();
+		switch (options_.policy) {
+		case overflow_policy::drop_oldest:
+			while (msgs_.size() > in_flight_ && over_limit(1, msg->length())) {
+				bytes_ -= msgs_[in_flight_]->length();
+				msgs_.erase(msgs_.begin() + in_flight_);
+				stats.record_drop_oldest();
+			}
+			if (over_limit(1, msg->length())) {
+				//剩下的都在发送中,只能丢弃新消息
+				stats.record_drop_newest();
+				return true;
+			}
+			append(msg);
+			return true;
+		case overflow_policy::drop_newest:
+			stats.record_drop_newest();
+			return true;
+		case overflow_policy::disconnect:
+		default:
+			stats.record_slow_disconnect();
+			return false;
+		}
+	}
+
+	/**
+	 * @brief 标记队首n条消息正在发送
+	 * @param n 条数
+	 * @return
+	 */
+	void set_in_flight(size_t n) {
+		in_flight_ = n;
+	}
+
+	/**
+	 * @brief 移除队首n条已发送完成的消息
+	 * @param n 条数
+	 * @return
+	 */
+	void pop_front(size_t n) {
+		for (size_t i = 0; i < n && !msgs_.empty(); ++i) {
+			bytes_ -= msgs_.front()->length();
+			msgs_.pop_front();
+		}
+		in_flight_ = in_flight_ > n ? in_flight_ - n : 0;
+	}
+
+	const chat_message_ptr &front() const {
+		return msgs_.front();
+	}
+
+	const_iterator begin() const {
+		return msgs_.begin();
+	}
+
+	const_iterator end() const {
+		return msgs_.end();
+	}
+
+	bool empty() const {
+		return msgs_.empty();
+	}
+
+	size_t size() const {
+		return msgs_.size();
+	}
+
+	size_t bytes() const {
+		return bytes_;
+	}
+
+private:
+	bool over_limit(size_t msgs, size_t bytes) const {
+		//空队列总能放下一条消息,避免单条大消息导致断开
+		if (msgs_.empty())
+			return false;
+		return (options_.max_msgs && msgs_.size() + msgs > options_.max_msgs) ||
+			   (options_.max_bytes && bytes_ + bytes > options_.max_bytes);
+	}
+
+	void append(const chat_message_ptr &msg) {
+		msgs_.push_back(msg);
+		bytes_ += msg->length();
+	}
+
+private:
+	send_queue_options options_;
+	chat_message_queue msgs_;
+	size_t bytes_ = 0;
+	size_t in_flight_ = 0;
+};
@@ -0,0 +1,274 @@
+﻿#include "server_config.h"
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <iostream>
+using namespace std;
+
+/**
+ * @brief 将"--key=value"拆分为key和value,没有value时value为空
+ * @param arg 参数
+ * @param key 输出的key
+ * @param value 输出的value
+ * @return bool 是否为--开头的参数
+ */
+static bool split_option(const string &arg, string &key, string &value) {
+	if (arg.size() <= 2 || arg.compare(0, 2, "--") != 0)
+		return false;
+	auto pos = arg.find('=');
+	if (pos == string::npos) {
+		key = arg.substr(2);
+		value.clear();
+	}
+	else {
+		key = arg.substr(2, pos - 2);
+		value = arg.substr(pos + 1);
+	}
+	return true;
+}
+
+/**
+ * @brief 将开关参数的value解析为bool,没有value视为true
+ * @param value 参数值
+ * @return bool
+ */
+static bool to_bool(const string &value) {
+	return value.empty() || value == "1" || value == "true" || value == "on";
+}
+
+/**
+ * @brief 解析命令行参数
+ * @param argc 参数个数
+ * @param argv 参数列表
+ * @param config 输出的配置
+ * @return bool 是否解析成功
+ */
+bool parse_server_config(int argc, const char *const *argv, server_config &config) {
+	int positional = 0;
+	for (int i = 1; i < argc; ++i) {
+		string arg(argv[i]);
+		string key, value;
+		if (!split_option(arg, key, value)) {
+			//旧的位置参数
+			if (positional == 0)
+				config.port = atoi(arg.c_str());
+			else if (positional == 1)
+				config.server_num = atoi(arg.c_str());
+			else
+				return false;
+			++positional;
+			continue;
+		}
+
+		if (key == "port") {
+			config.port = atoi(value.c_str());
+		}
+		else if (key == "servers") {
+			config.server_num = atoi(value.c_str());
+		}
+		else if (key == "per-core") {
+			config.per_core = to_bool(value);
+		}
+		else if (key == "reactors") {
+			config.per_core = true;
+			config.reactor_num = atoi(value.c_str());
+		}
+		else if (key == "io-uring") {
+			config.io_uring = to_bool(value);
+		}
+		else if (key == "pin") {
+			config.pin_threads = to_bool(value);
+		}
+		else if (key == "max-body") {
+			config.max_body_length = strtoul(value.c_str(), nullptr, 10);
+		}
+		else if (key == "batch-window-us") {
+			config.room.batch_window_us = atoi(value.c_str());
+		}
+		else if (key == "batch-max") {
+			config.room.batch_max_msgs = atoi(value.c_str());
+		}
+		else if (key == "queue-max-msgs") {
+			config.queue.max_msgs = strtoul(value.c_str(), nullptr, 10);
+		}
+		else if (key == "queue-max-bytes") {
+			config.queue.max_bytes = strtoul(value.c_str(), nullptr, 10);
+		}
+		else if (key == "queue-policy") {
+			if (!parse_overflow_policy(value, config.queue.policy)) {
+				cerr << "unknown queue policy " << value << endl;
+				return false;
+			}
+		}
+		else if (key == "accepts") {
+			config.accept_concurrency = atoi(value.c_str());
+		}
+		else if (key == "log-connections") {
+			config.log_connections = to_bool(value);
+		}
+		else if (key == "join-batch") {
+			config.room.join_batch = atoi(value.c_str());
+		}
+		else if (key == "join-interval-ms") {
+			config.room.join_interval_ms = atoi(value.c_str());
+		}
+		else if (key == "stats-interval") {
+			config.stats_interval = atoi(value.c_str());
+		}
+		else if (key == "fanout-threshold") {
+			config.room.fanout_threshold = atoi(value.c_str());
+		}
+		else if (key == "fanout-partitions") {
+			config.room.fanout_partitions = atoi(value.c_str());
+		}
+		else if (key == "history-depth") {
+			config.room.history_depth = atoi(value.c_str());
+		}
+		else if (key == "codecs") {
+			config.codec.allowed = 1u << CODEC_PROTOBUF;
+			stringstream ss(value);
+			string name;
+			while (getline(ss, name, ',')) {
+				int codec = codec_from_name(name);
+				if (!codec) {
+					cerr << "unknown codec " << name << endl;
+					return false;
+				}
+				config.codec.allowed |= 1u << codec;
+			}
+		}
+		else if (key == "codec-timeout-ms") {
+			config.codec.handshake_timeout_ms = atoi(value.c_str());
+		}
+		else if (key == "lobby-auto-join") {
+			config.room.lobby_auto_join = to_bool(value);
+		}
+		else if (key == "log-dir") {
+			config.room.log.dir = value;
+		}
+		else if (key == "log-segment-mb") {
+			config.room.log.segment_bytes = size_t(atoi(value.c_str())) * 1024 * 1024;
+		}
+		else if (key == "log-index-interval") {
+			config.room.log.index_interval_bytes = size_t(atoi(value.c_str()));
+		}
+		else if (key == "log-fsync-ms") {
+			config.room.log.fsync_interval_ms = atoi(value.c_str());
+		}
+		else if (key == "log-retention-mb") {
+			config.room.log.retention_bytes = strtoull(value.c_str(), nullptr, 10) * 1024 * 1024;
+		}
+		else if (key == "log-retention-sec") {
+			config.room.log.retention_seconds = atoll(value.c_str());
+		}
+		else if (key == "log-compact") {
+			config.room.log.compact = to_bool(value);
+		}
+		else if (key == "room-shards") {
+			config.room_shards = atoi(value.c_str());
+		}
+		else if (key == "node-id") {
+			config.cluster.node_id = strtoull(value.c_str(), nullptr, 10);
+		}
+		else if (key == "node-port") {
+			config.cluster.node_port = atoi(value.c_str());
+		}
+		else if (key == "peers") {
+			config.cluster.peers.clear();
+			stringstream ss(value);
+			string peer;
+			while (getline(ss, peer, ',')) {
+				auto colon = peer.rfind(':');
+				if (colon == string::npos || colon == 0 || colon + 1 == peer.size()) {
+					cerr << "bad peer address " << peer << ", expected host:port" << endl;
+					return false;
+				}
+				config.cluster.peers.push_back(peer);
+			}
+		}
+		else if (key == "backends") {
+			config.proxy.backends.clear();
+			stringstream ss(value);
+			string backend;
+			while (getline(ss, backend, ','))
+				config.proxy.backends.push_back(backend);
+		}
+		else if (key == "backends-file") {
+			config.proxy.backends_file = value;
+		}
+		else if (key == "vnodes") {
+			config.proxy.virtual_nodes = atoi(value.c_str());
+		}
+		else if (key == "unix") {
+			config.unix_path = value;
+		}
+		else if (key == "shm") {
+			config.shm_path = value;
+		}
+		else {
+			cerr << "unknown option " << arg << endl;
+			return false;
+		}
+	}
+	return config.port > 0 && config.server_num > 0 && config.reactor_num >= 0
+		&& config.stats_interval >= 0 && config.room_shards >= 0
+		&& config.room.batch_window_us >= 0 && config.room.batch_max_msgs > 0
+		&& config.accept_concurrency > 0
+		&& config.room.join_batch >= 0 && config.room.join_interval_ms > 0
+		&& config.room.fanout_threshold >= 0 && config.room.fanout_partitions >= 0
+		&& config.room.history_depth >= 0
+		&& config.codec.handshake_timeout_ms > 0
+		&& config.room.log.segment_bytes > 0 && config.room.log.index_interval_bytes > 0
+		&& config.room.log.fsync_interval_ms >= 0 && config.room.log.retention_seconds >= 0
+		&& config.cluster.node_port >= 0 && config.proxy.virtual_nodes > 0
+		&& (!config.cluster.enabled() || config.cluster.node_id > 0);
+}
+
+/**
+ * @brief 打印命令行参数说明
+ * @param program 程序名
+ * @return
+ */
+void print_server_usage(const char *program) {
+	cerr << "usage: " << program << " [port] [server_num] [options]\n"
+		 << "  --port=N          listen port (default 8000)\n"
+		 << "  --servers=N       chat_server count sharing one io_service (default 2)\n"
+		 << "  --per-core        one io_service per core, SO_REUSEPORT acceptor each\n"
+		 << "  --reactors=N      reactor count for --per-core (default cpu count)\n"
+		 << "  --io-uring        io_uring transport, one ring per reactor (Linux, falls back to epoll)\n"
+		 << "  --pin=0|1         pin reactor threads to cpus (default 1)\n"
+		 << "  --max-body=N      max message body bytes (default 65528)\n"
+		 << "  --batch-window-us=N batch room broadcasts for up to N us under load (default 0, off)\n"
+		 << "  --batch-max=N     max messages per broadcast batch (default 64)\n"
+		 << "  --queue-max-msgs=N per-connection send queue limit in messages (default 0, unlimited)\n"
+		 << "  --queue-max-bytes=N per-connection send queue limit in bytes (default 0, unlimited)\n"
+		 << "  --queue-policy=P  drop-oldest|drop-newest|disconnect when a send queue is full\n"
+		 << "  --accepts=N       concurrent accepts per acceptor (default 4)\n"
+		 << "  --log-connections=0|1 log client joins on a background thread (default 1)\n"
+		 << "  --join-batch=N    admit at most N joins (history replays) per interval (default 0, unlimited)\n"
+		 << "  --join-interval-ms=N join admission interval (default 10)\n"
+		 << "  --stats-interval=S print write statistics every S seconds (default 0, off)\n"
+		 << "  --fanout-threshold=N split rooms with N+ members into parallel fan-out partitions (default 1024, 0 off)\n"
+		 << "  --fanout-partitions=N partitions per large room (default one per room shard)\n"
+		 << "  --history-depth=N messages kept per room and replayed on join (default 100, 0 off)\n"
+		 << "  --lobby-auto-join=0|1 join the lobby on connect (default 1); 0 lets clients resync it with JoinRoom 0 last_seq\n"
+		 << "  --log-dir=DIR     persist room history in append-only segmented logs under DIR\n"
+		 << "  --log-segment-mb=N log segment size (default 16)\n"
+		 << "  --log-index-interval=N bytes between sparse index entries (default 4096)\n"
+		 << "  --log-fsync-ms=N  batch log fsyncs every N ms (default 200, 0 leaves it to the OS)\n"
+		 << "  --log-retention-mb=N keep at most N MB of log per room (default 0, unlimited)\n"
+		 << "  --log-retention-sec=N drop log records older than N seconds (default 0, unlimited)\n"
+		 << "  --log-compact=0|1 rewrite the oldest segment once half of it has expired (default 1)\n"
+		 << "  --room-shards=N   room registry shards (default one per reactor / per server thread)\n"
+		 << "  --node-port=N     join a cluster: accept links from other chat_server nodes on port N\n"
+		 << "  --peers=H:P,...   node links to dial; each pair of nodes keeps one link\n"
+		 << "  --node-id=N       unique node id in the cluster, required with --node-port/--peers\n"
+		 << "  --backends=H:P,... run as a front proxy, placing rooms on these chat_server backends by consistent hash\n"
+		 << "  --backends-file=PATH proxy backend list, one host:port per line, re-read every second\n"
+		 << "  --vnodes=N        virtual nodes per backend on the hash ring (default 160)\n"
+		 << "  --codecs=C,...    codecs clients may negotiate: raw,text,json,protobuf,flat (default protobuf only, no handshake)\n"
+		 << "  --codec-timeout-ms=N wait N ms for a client's codec hello before assuming protobuf (default 200)\n"
+		 << "  --unix=PATH       also accept local clients on a unix domain socket\n"
+		 << "  --shm=PATH        also accept local clients over shared memory rings, PATH is the handshake socket\n";
+}
@@ -0,0 +1,67 @@
+﻿#pragma once
+#include <string>
+#include "chat_room.h"
+#include "chat_codec.h"
+#include "chat_proxy.h"
+#include "cluster_node.h"
+#include "send_queue.h"
+
+/**
+ * @brief 服务端运行参数
+ *        兼容旧的位置参数: chat_server [port] [server_num]
+ *        其余参数使用 --key=value 的形式给出
+ */
+struct server_config {
+	//监听端口
+	int port = 8000;
+	//共享io_service模式下chat_server的数量
+	int server_num = 2;
+	//是否使用每核心一个io_service的模式
+	bool per_core = false;
+	//每核心模式下的reactor数量,0表示使用cpu核心数
+	int reactor_num = 0;
+	//使用io_uring传输后端(每个reactor一个ring),不可用时回退到epoll
+	bool io_uring = false;
+	//每核心模式下是否将线程绑定到cpu
+	bool pin_threads = true;
+	//消息体长度上限,0表示使用chat_message的默认值
+	size_t max_body_length = 0;
+	//房间参数(广播攒批等)
+	room_options room;
+	//房间表的分片数,0表示每个reactor一个(共享io_service模式下为server_num个)
+	int room_shards = 0;
+	//每个连接的发送队列上限和满时的策略
+	send_queue_options queue;
+	//每个acceptor同时进行中的accept数量
+	int accept_concurrency = 4;
+	//是否输出客户端加入日志
+	bool log_connections = true;
+	//统计信息打印间隔(秒),0表示不打印
+	int stats_interval = 0;
+	//本机客户端使用的Unix域socket路径,空表示不监听
+	std::string unix_path;
+	//本机共享内存传输的握手socket路径,空表示不监听
+	std::string shm_path;
+	//集群参数,未设置node_port和peers时单机运行
+	cluster_options cluster;
+	//前端代理参数,给出后端时以代理模式运行,不承载房间
+	proxy_options proxy;
+	//客户端可以协商的编码,只有protobuf时不协商
+	codec_options codec;
+};
+
+/**
+ * @brief 解析命令行参数
+ * @param argc 参数个数
+ * @param argv 参数列表
+ * @param config 输出的配置
+ * @return bool 是否解析成功
+ */
+bool parse_server_config(int argc, const char *const *argv, server_config &config);
+
+/**
+ * @brief 打印命令行参数说明
+ * @param program 程序名
+ * @return
+ */
+void print_server_usage(const char *program);
@@ -0,0 +1,315 @@
+﻿#pragma once
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include "struct_header.h"
+
+/**
+ * @brief 服务端运行时计数器,所有计数都使用relaxed原子操作,只用于观测
+ */
+class server_stats {
+public:
+	/**
+	 * @brief 获取全局唯一的统计对象
+	 * @param
+	 * @return server_stats引用
+	 */
+	static server_stats &instance() {
+		static server_stats stats;
+		return stats;
+	}
+
+	/**
+	 * @brief 记录一次合并写
+	 * @param msgs 本次写出的消息条数
+	 * @param bytes 本次写出的字节数
+	 * @return
+	 */
+	void record_flush(size_t msgs, size_t bytes) {
+		write_flushes_.fetch_add(1, std::memory_order_relaxed);
+		write_flush_msgs_.fetch_add(msgs, std::memory_order_relaxed);
+		write_flush_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+		flush_histogram_[histogram_bucket(msgs)].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次读取
+	 * @param frames 本次读取解析出的完整帧数
+	 * @return
+	 */
+	void record_read(size_t frames) {
+		reads_.fetch_add(1, std::memory_order_relaxed);
+		read_frames_.fetch_add(frames, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次攒批广播
+	 * @param msgs 本批的消息条数
+	 * @return
+	 */
+	void record_batch(size_t msgs) {
+		broadcast_batches_.fetch_add(1, std::memory_order_relaxed);
+		batched_msgs_.fetch_add(msgs, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 发送队列满时丢弃了一条最早的消息
+	 * @param
+	 * @return
+	 */
+	void record_drop_oldest() {
+		drops_oldest_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 发送队列满时丢弃了新到的消息
+	 * @param
+	 * @return
+	 */
+	void record_drop_newest() {
+		drops_newest_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 发送队列满时断开了一个慢客户端
+	 * @param
+	 * @return
+	 */
+	void record_slow_disconnect() {
+		slow_disconnects_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次accept
+	 * @param
+	 * @return
+	 */
+	void record_accept() {
+		accepts_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次延后的加入,加入请求在准入队列中等待
+	 * @param
+	 * @return
+	 */
+	void record_deferred_join() {
+		deferred_joins_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一个房间被创建
+	 * @param
+	 * @return
+	 */
+	void record_room_created() {
+		rooms_created_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一个空房间被回收
+	 * @param
+	 * @return
+	 */
+	void record_room_reclaimed() {
+		rooms_reclaimed_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一个大房间被拆分为多个并行广播的分区
+	 * @param
+	 * @return
+	 */
+	void record_room_partitioned() {
+		rooms_partitioned_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次成员快照重建
+	 * @param changes 本次合并的加入/离开数
+	 * @return
+	 */
+	void record_snapshot_rebuild(size_t changes) {
+		snapshot_rebuilds_.fetch_add(1, std::memory_order_relaxed);
+		membership_changes_.fetch_add(changes, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次房间日志的批量落盘
+	 * @param bytes 本次落盘的字节数
+	 * @return
+	 */
+	void record_log_sync(size_t bytes) {
+		log_syncs_.fetch_add(1, std::memory_order_relaxed);
+		log_synced_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次带last_seq的续传加入
+	 * @param too_far 缺口是否超出保留的历史,此时重放了完整历史
+	 * @param skipped 客户端已收到而不再重放的消息数
+	 * @return
+	 */
+	void record_resync(bool too_far, size_t skipped) {
+		(too_far ? resyncs_too_far_ : resyncs_).fetch_add(1, std::memory_order_relaxed);
+		resync_skipped_msgs_.fetch_add(skipped, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一条私聊
+	 * @param delivered 目标是否在线
+	 * @return
+	 */
+	void record_direct(bool delivered) {
+		(delivered ? direct_msgs_ : direct_undeliverable_).fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一次节点间的房间广播转发
+	 * @param incoming 是收到的转发还是发出的转发
+	 * @param links 发出时是发往的节点数,收到时为1
+	 * @return
+	 */
+	void record_node_relay(bool incoming, size_t links) {
+		if (incoming) {
+			node_relays_in_.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		node_relays_out_.fetch_add(1, std::memory_order_relaxed);
+		node_relay_frames_.fetch_add(links, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录代理发布了一个新的哈希环
+	 * @param
+	 * @return
+	 */
+	void record_proxy_rebalance() {
+		proxy_rebalances_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录代理的一个连接因哈希环变化把房间移到了新的后端
+	 * @param rooms 移动的房间数
+	 * @return
+	 */
+	void record_proxy_moves(size_t rooms) {
+		proxy_room_moves_.fetch_add(rooms, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 记录一个连接协商出的编码
+	 * @param codec CodecType之一
+	 * @return
+	 */
+	void record_codec(int codec) {
+		if (codec >= CODEC_RAW && codec <= CODEC_FLAT)
+			codec_sessions_[codec].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief 打印并输出当前计数
+	 * @param os 输出流
+	 * @return
+	 */
+	void print(std::ostream &os) const {
+		auto reads = reads_.load(std::memory_order_relaxed);
+		auto frames = read_frames_.load(std::memory_order_relaxed);
+		auto flushes = write_flushes_.load(std::memory_order_relaxed);
+		auto msgs = write_flush_msgs_.load(std::memory_order_relaxed);
+		os << "[stats] accepts=" << accepts_.load(std::memory_order_relaxed)
+		   << " deferred_joins=" << deferred_joins_.load(std::memory_order_relaxed)
+		   << " reads=" << reads
+		   << " frames=" << frames
+		   << " frames/read=" << (reads ? double(frames) / reads : 0.0)
+		   << " flushes=" << flushes
+		   << " msgs=" << msgs
+		   << " bytes=" << write_flush_bytes_.load(std::memory_order_relaxed)
+		   << " msgs/flush=" << (flushes ? double(msgs) / flushes : 0.0)
+		   << " flush_size{1,2-4,5-16,17-64,65+}=";
+		for (int i = 0; i < histogram_buckets; ++i)
+			os << (i ? "," : "") << flush_histogram_[i].load(std::memory_order_relaxed);
+		os << " batches=" << broadcast_batches_.load(std::memory_order_relaxed)
+		   << " batched_msgs=" << batched_msgs_.load(std::memory_order_relaxed)
+		   << " drop_oldest=" << drops_oldest_.load(std::memory_order_relaxed)
+		   << " drop_newest=" << drops_newest_.load(std::memory_order_relaxed)
+		   << " slow_disconnects=" << slow_disconnects_.load(std::memory_order_relaxed);
+		auto created = rooms_created_.load(std::memory_order_relaxed);
+		auto reclaimed = rooms_reclaimed_.load(std::memory_order_relaxed);
+		os << " rooms=" << created - reclaimed
+		   << " rooms_created=" << created
+		   << " rooms_reclaimed=" << reclaimed
+		   << " rooms_partitioned=" << rooms_partitioned_.load(std::memory_order_relaxed);
+		auto rebuilds = snapshot_rebuilds_.load(std::memory_order_relaxed);
+		auto changes = membership_changes_.load(std::memory_order_relaxed);
+		os << " snapshot_rebuilds=" << rebuilds
+		   << " changes/rebuild=" << (rebuilds ? double(changes) / rebuilds : 0.0);
+		os << " log_syncs=" << log_syncs_.load(std::memory_order_relaxed)
+		   << " log_synced_bytes=" << log_synced_bytes_.load(std::memory_order_relaxed);
+		os << " resyncs=" << resyncs_.load(std::memory_order_relaxed)
+		   << " resyncs_too_far=" << resyncs_too_far_.load(std::memory_order_relaxed)
+		   << " resync_skipped_msgs=" << resync_skipped_msgs_.load(std::memory_order_relaxed);
+		os << " direct_msgs=" << direct_msgs_.load(std::memory_order_relaxed)
+		   << " direct_undeliverable=" << direct_undeliverable_.load(std::memory_order_relaxed);
+		os << " node_relays_out=" << node_relays_out_.load(std::memory_order_relaxed)
+		   << " node_relay_frames=" << node_relay_frames_.load(std::memory_order_relaxed)
+		   << " node_relays_in=" << node_relays_in_.load(std::memory_order_relaxed);
+		os << " proxy_rebalances=" << proxy_rebalances_.load(std::memory_order_relaxed)
+		   << " proxy_room_moves=" << proxy_room_moves_.load(std::memory_order_relaxed);
+		os << " codecs{raw,text,json,protobuf,flat}=";
+		for (int codec = CODEC_RAW; codec <= CODEC_FLAT; ++codec)
+			os << (codec != CODEC_RAW ? "," : "") << codec_sessions_[codec].load(std::memory_order_relaxed);
+		os << std::endl;
+	}
+
+private:
+	enum { histogram_buckets = 5 };
+
+	static int histogram_bucket(size_t msgs) {
+		if (msgs <= 1)
+			return 0;
+		if (msgs <= 4)
+			return 1;
+		if (msgs <= 16)
+			return 2;
+		if (msgs <= 64)
+			return 3;
+		return 4;
+	}
+
+	server_stats() = default;
+
+private:
+	std::atomic<uint64_t> accepts_{ 0 };
+	std::atomic<uint64_t> deferred_joins_{ 0 };
+	std::atomic<uint64_t> reads_{ 0 };
+	std::atomic<uint64_t> read_frames_{ 0 };
+	std::atomic<uint64_t> write_flushes_{ 0 };
+	std::atomic<uint64_t> write_flush_msgs_{ 0 };
+	std::atomic<uint64_t> write_flush_bytes_{ 0 };
+	std::atomic<uint64_t> flush_histogram_[histogram_buckets] = {};
+	std::atomic<uint64_t> broadcast_batches_{ 0 };
+	std::atomic<uint64_t> batched_msgs_{ 0 };
+	std::atomic<uint64_t> drops_oldest_{ 0 };
+	std::atomic<uint64_t> drops_newest_{ 0 };
+	std::atomic<uint64_t> slow_disconnects_{ 0 };
+	std::atomic<uint64_t> rooms_created_{ 0 };
+	std::atomic<uint64_t> rooms_reclaimed_{ 0 };
+	std::atomic<uint64_t> rooms_partitioned_{ 0 };
+	std::atomic<uint64_t> snapshot_rebuilds_{ 0 };
+	std::atomic<uint64_t> membership_changes_{ 0 };
+	std::atomic<uint64_t> log_syncs_{ 0 };
+	std::atomic<uint64_t> log_synced_bytes_{ 0 };
+	std::atomic<uint64_t> resyncs_{ 0 };
+	std::atomic<uint64_t> resyncs_too_far_{ 0 };
+	std::atomic<uint64_t> resync_skipped_msgs_{ 0 };
+	std::atomic<uint64_t> direct_msgs_{ 0 };
+	std::atomic<uint64_t> direct_undeliverable_{ 0 };
+	std::atomic<uint64_t> node_relays_out_{ 0 };
+	std::atomic<uint64_t> node_relay_frames_{ 0 };
+	std::atomic<uint64_t> node_relays_in_{ 0 };
+	std::atomic<uint64_t> proxy_rebalances_{ 0 };
+	std::atomic<uint64_t> proxy_room_moves_{ 0 };
+	//按CodecType下标,只统计经过协商的连接
+	std::atomic<uint64_t> codec_sessions_[CODEC_FLAT + 1] = {};
+};
@@ -0,0 +1,62 @@
+﻿#include "session_directory.h"
+
+/**
+ * @brief 构造
+ * @param shard_num 分片数
+ * @return 本类对象
+ */
+session_directory::session_directory(size_t shard_num) {
+	if (shard_num == 0)
+		shard_num = 1;
+	for (size_t i = 0; i < shard_num; ++i)
+		shards_.emplace_back(new shard());
+}
+
+/**
+ * @brief 把名字绑定到客户端,名字已被另一个在线客户端占用时失败
+ * @param name 名字
+ * @param cp 客户端智能指针
+ * @return bool 是否绑定成功
+ */
+bool session_directory::bind(const std::string &name, const chat_participant_ptr &cp) {
+	auto &s = shard_of(name);
+	std::lock_guard<std::mutex> lock(s.mutex);
+	auto &entry = s.sessions[name];
+	auto holder = entry.lock();
+	if (holder && holder != cp)
+		return false;
+	//原来的客户端已下线但还没解绑时直接接管
+	entry = cp;
+	return true;
+}
+
+/**
+ * @brief 解除名字的绑定,名字已属于其他客户端时什么也不做
+ * @param name 名字
+ * @param cp 绑定时的客户端,可以已经析构
+ * @return
+ */
+void session_directory::unbind(const std::string &name, const std::weak_ptr<chat_participant> &cp) {
+	auto &s = shard_of(name);
+	std::lock_guard<std::mutex> lock(s.mutex);
+	auto it = s.sessions.find(name);
+	//按控制块比较,客户端析构后也能认出是不是自己
+	if (it != s.sessions.end() && !it->second.owner_before(cp) && !cp.owner_before(it->second))
+		s.sessions.erase(it);
+}
+
+/**
+ * @brief 按名字查找在线的客户端
+ * @param name 名字
+ * @return chat_participant_ptr 不存在或已下线时返回nullptr
+ */
+chat_participant_ptr session_directory::find(const std::string &name) const {
+	auto &s = shard_of(name);
+	std::lock_guard<std::mutex> lock(s.mutex);
+	auto it = s.sessions.find(name);
+	return it == s.sessions.end() ? nullptr : it->second.lock();
+}
+
+session_directory::shard &session_directory::shard_of(const std::string &name) const {
+	return *shards_[std::hash<std::string>()(name) % shards_.size()];
+}
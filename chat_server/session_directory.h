@@ -0,0 +1,63 @@
+﻿#pragma once
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "chat_room.h"
+
+/**
+ * @brief 按名字索引的在线客户端表,用于私聊直接投递到目标客户端的发送队列
+ *        分成多个分片,每个分片一把互斥锁和一张哈希表,名字的哈希决定分片,
+ *        绑定、解绑和查找都是O(1),不同名字的操作很少竞争同一把锁
+ *        表中只保存weak_ptr,不延长客户端的生命周期
+ */
+class session_directory {
+public:
+	/**
+	 * @brief 构造
+	 * @param shard_num 分片数
+	 * @return 本类对象
+	 */
+	explicit session_directory(size_t shard_num = 64);
+
+	session_directory(const session_directory &) = delete;
+	session_directory &operator=(const session_directory &) = delete;
+
+	/**
+	 * @brief 把名字绑定到客户端,名字已被另一个在线客户端占用时失败
+	 * @param name 名字
+	 * @param cp 客户端智能指针
+	 * @return bool 是否绑定成功
+	 */
+	bool bind(const std::string &name, const chat_participant_ptr &cp);
+
+	/**
+	 * @brief 解除名字的绑定,名字已属于其他客户端时什么也不做
+	 * @param name 名字
+	 * @param cp 绑定时的客户端,可以已经析构
+	 * @return
+	 */
+	void unbind(const std::string &name, const std::weak_ptr<chat_participant> &cp);
+
+	/**
+	 * @brief 按名字查找在线的客户端
+	 * @param name 名字
+	 * @return chat_participant_ptr 不存在或已下线时返回nullptr
+	 */
+	chat_participant_ptr find(const std::string &name) const;
+
+private:
+	/**
+	 * @brief 一个分片,sessions只在持有mutex时访问
+	 */
+	struct shard {
+		mutable std::mutex mutex;
+		std::unordered_map<std::string, std::weak_ptr<chat_participant>> sessions;
+	};
+
+	shard &shard_of(const std::string &name) const;
+
+private:
+	std::vector<std::unique_ptr<shard>> shards_;
+};
@@ -0,0 +1,618 @@
+﻿#pragma once
+#include <boost/asio.hpp>
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS) && !defined(_WIN32)
+#define CHAT_SERVER_HAS_SHM 1
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief 共享内存中单生产者单消费者字节环的控制块,head/tail单调递增,各占一个cache line
+ */
+struct shm_ring_header {
+	alignas(64) std::atomic<uint64_t> head;
+	alignas(64) std::atomic<uint64_t> tail;
+	//读者环空等待门铃/写者环满等待门铃
+	alignas(64) std::atomic<uint32_t> reader_waiting;
+	std::atomic<uint32_t> writer_waiting;
+};
+
+/**
+ * @brief 单生产者单消费者字节环,容量为2的幂
+ *        控制块在对方可写的共享内存中,head/tail每次只读取一次,tail - head超过容量时视为损坏,不再拷贝
+ */
+class shm_ring {
+public:
+	shm_ring() = default;
+
+	shm_ring(shm_ring_header *header, char *data, size_t capacity)
+		: header_(header), data_(data), capacity_(capacity) {
+	}
+
+	shm_ring_header *header() const {
+		return header_;
+	}
+
+	/**
+	 * @brief 可读的字节数,控制块损坏时也返回非0,由随后的read报告错误
+	 * @param
+	 * @return size_t
+	 */
+	size_t readable() const {
+		return size_t(header_->tail.load(std::memory_order_acquire) -
+					  header_->head.load(std::memory_order_relaxed));
+	}
+
+	/**
+	 * @brief 可写的字节数,控制块损坏时也返回非0,由随后的write报告错误
+	 * @param
+	 * @return size_t
+	 */
+	size_t writable() const {
+		uint64_t used = header_->tail.load(std::memory_order_relaxed) - header_->head.load(std::memory_order_acquire);
+		return used > capacity_ ? 1 : capacity_ - size_t(used);
+	}
+
+	/**
+	 * @brief 读取至多length字节
+	 * @param out 输出
+	 * @param length 最多读取的字节数
+	 * @param ec 控制块损坏时为protocol_error
+	 * @return size_t 实际读取的字节数
+	 */
+	size_t read(void *out, size_t length, boost::system::error_code &ec) {
+		uint64_t head = header_->head.load(std::memory_order_relaxed);
+		uint64_t tail = header_->tail.load(std::memory_order_acquire);
+		if (tail - head > capacity_) {
+			ec = boost::system::errc::make_error_code(boost::system::errc::protocol_error);
+			return 0;
+		}
+		size_t n = std::min(length, size_t(tail - head));
+		size_t offset = size_t(head) & (capacity_ - 1);
+		size_t first = std::min(n, capacity_ - offset);
+		memcpy(out, data_ + offset, first);
+		memcpy(static_cast<char *>(out) + first, data_, n - first);
+		header_->head.store(head + n, std::memory_order_release);
+		return n;
+	}
+
+	/**
+	 * @brief 写入至多length字节
+	 * @param in 输入
+	 * @param length 最多写入的字节数
+	 * @param ec 控制块损坏时为protocol_error
+	 * @return size_t 实际写入的字节数
+	 */
+	size_t write(const void *in, size_t length, boost::system::error_code &ec) {
+		uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+		uint64_t head = header_->head.load(std::memory_order_acquire);
+		if (tail - head > capacity_) {
+			ec = boost::system::errc::make_error_code(boost::system::errc::protocol_error);
+			return 0;
+		}
+		size_t n = std::min(length, capacity_ - size_t(tail - head));
+		size_t offset = size_t(tail) & (capacity_ - 1);
+		size_t first = std::min(n, capacity_ - offset);
+		memcpy(data_ + offset, in, first);
+		memcpy(data_, static_cast<const char *>(in) + first, n - first);
+		header_->tail.store(tail + n, std::memory_order_release);
+		return n;
+	}
+
+	/**
+	 * @brief 按顺序读满buffers,直到环为空
+	 * @param buffers 输出缓冲区序列
+	 * @param ec 控制块损坏时为protocol_error
+	 * @return size_t 实际读取的字节数
+	 */
+	template <typename MutableBuffers>
+	size_t read_some(const MutableBuffers &buffers, boost::system::error_code &ec) {
+		size_t total = 0;
+		for (const auto &buffer : buffers) {
+			size_t n = read(buffer.data(), buffer.size(), ec);
+			total += n;
+			if (ec || n < buffer.size())
+				break;
+		}
+		return total;
+	}
+
+	/**
+	 * @brief 按顺序写入buffers,直到环写满
+	 * @param buffers 输入缓冲区序列
+	 * @param ec 控制块损坏时为protocol_error
+	 * @return size_t 实际写入的字节数
+	 */
+	template <typename ConstBuffers>
+	size_t write_some(const ConstBuffers &buffers, boost::system::error_code &ec) {
+		size_t total = 0;
+		for (const auto &buffer : buffers) {
+			size_t n = write(buffer.data(), buffer.size(), ec);
+			total += n;
+			if (ec || n < buffer.size())
+				break;
+		}
+		return total;
+	}
+
+private:
+	shm_ring_header *header_ = nullptr;
+	char *data_ = nullptr;
+	size_t capacity_ = 0;
+};
+
+/**
+ * @brief 服务端创建、通过Unix域socket把描述符传给客户端的共享内存段,包含客户端->服务端和服务端->客户端两个环
+ *        段没有名字,客户端无法让服务端打开或删除任意共享内存对象;支持密封时大小被密封,客户端不能截断映射
+ */
+class shm_segment {
+public:
+	//环的容量下限为一页,对方不能用极小的环配合伪造的下标让拷贝越过映射;上限限制单个客户端占用的内存
+	enum { default_ring_size = 1 << 20, min_ring_size = 4096, max_ring_size = 1 << 24 };
+
+	shm_segment() = default;
+
+	shm_segment(shm_segment &&other) noexcept
+		: base_(other.base_), size_(other.size_), ring_size_(other.ring_size_), fd_(other.fd_) {
+		other.base_ = nullptr;
+		other.size_ = 0;
+		other.fd_ = -1;
+	}
+
+	shm_segment &operator=(shm_segment &&other) noexcept {
+		std::swap(base_, other.base_);
+		std::swap(size_, other.size_);
+		std::swap(ring_size_, other.ring_size_);
+		std::swap(fd_, other.fd_);
+		return *this;
+	}
+
+	shm_segment(const shm_segment &) = delete;
+	shm_segment &operator=(const shm_segment &) = delete;
+
+	~shm_segment() {
+		if (base_)
+			munmap(base_, size_);
+		close_fd();
+	}
+
+	/**
+	 * @brief 服务端创建匿名的共享内存段,描述符保留到close_fd,用于传给客户端
+	 * @param ring_size 每个环的容量,必须是2的幂,在min_ring_size和max_ring_size之间
+	 * @param ec 错误码
+	 * @return shm_segment
+	 */
+	static shm_segment create(size_t ring_size, boost::system::error_code &ec) {
+		shm_segment segment;
+		if (ring_size < min_ring_size || ring_size > max_ring_size || (ring_size & (ring_size - 1)) != 0) {
+			ec = boost::asio::error::invalid_argument;
+			return segment;
+		}
+#ifdef MFD_ALLOW_SEALING
+		int fd = memfd_create("chat_shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+#else
+		//没有memfd时用随机名字创建后立即删除名字,只能通过传出的描述符访问
+		static std::atomic<unsigned> counter(0);
+		std::string name = "/chat_shm." + std::to_string(::getpid()) + "." + std::to_string(counter++);
+		int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (fd >= 0)
+			shm_unlink(name.c_str());
+#endif
+		if (fd < 0) {
+			ec.assign(errno, boost::system::system_category());
+			return segment;
+		}
+		segment.fd_ = fd;
+		size_t size = total_size(ring_size);
+		if (ftruncate(fd, off_t(size)) != 0 ||
+#ifdef MFD_ALLOW_SEALING
+			fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0 ||
+#endif
+			!segment.map(fd, size)) {
+			ec.assign(errno, boost::system::system_category());
+			return shm_segment();
+		}
+		auto control = segment.control();
+		control->magic = magic;
+		control->version = version;
+		control->ring_size = ring_size;
+		segment.ring_size_ = ring_size;
+		new (segment.ring_header(0)) shm_ring_header();
+		new (segment.ring_header(1)) shm_ring_header();
+		ec = boost::system::error_code();
+		return segment;
+	}
+
+	/**
+	 * @brief 客户端映射服务端传来的共享内存段,检查大小、magic和版本
+	 * @param fd 收到的描述符,无论成功与否都由本函数关闭
+	 * @param ec 错误码
+	 * @return shm_segment
+	 */
+	static shm_segment attach(int fd, boost::system::error_code &ec) {
+		shm_segment segment;
+		struct stat st;
+		if (fstat(fd, &st) != 0 || size_t(st.st_size) < total_size(min_ring_size) ||
+			!segment.map(fd, size_t(st.st_size))) {
+			ec.assign(errno ? errno : EINVAL, boost::system::system_category());
+			::close(fd);
+			return segment;
+		}
+		::close(fd);
+		auto control = segment.control();
+		size_t ring_size = size_t(control->ring_size);
+		if (control->magic != magic || control->version != version || ring_size < min_ring_size ||
+			(ring_size & (ring_size - 1)) != 0 || total_size(ring_size) > segment.size_) {
+			ec = boost::asio::error::invalid_argument;
+			return shm_segment();
+		}
+		segment.ring_size_ = ring_size;
+		ec = boost::system::error_code();
+		return segment;
+	}
+
+	bool valid() const {
+		return base_ != nullptr;
+	}
+
+	int fd() const {
+		return fd_;
+	}
+
+	/**
+	 * @brief 描述符传给客户端后关闭,映射仍然有效
+	 * @param
+	 * @return
+	 */
+	void close_fd() {
+		if (fd_ >= 0)
+			::close(fd_);
+		fd_ = -1;
+	}
+
+	/**
+	 * @brief 在Unix域socket上发送一段数据,并附带一个描述符
+	 * @param socket socket的描述符
+	 * @param data 数据,至少一个字节,描述符随第一个字节到达
+	 * @param size 数据长度
+	 * @param fd 要传递的描述符
+	 * @param ec 错误码
+	 * @return
+	 */
+	static void send_fd(int socket, const void *data, size_t size, int fd, boost::system::error_code &ec) {
+		iovec iov{ const_cast<void *>(data), size };
+		alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+		msghdr msg{};
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control;
+		msg.msg_controllen = sizeof(control);
+		cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_RIGHTS;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+		std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+		ssize_t n = ::sendmsg(socket, &msg, MSG_NOSIGNAL);
+		if (n < 0)
+			ec.assign(errno, boost::system::system_category());
+		else if (size_t(n) != size)
+			ec = boost::asio::error::would_block;
+		else
+			ec = boost::system::error_code();
+	}
+
+	/**
+	 * @brief 在阻塞的Unix域socket上读满一段数据,并取出随数据到达的描述符
+	 * @param socket socket的描述符
+	 * @param data 输出的数据
+	 * @param size 要读取的长度
+	 * @param fd 输出收到的描述符,没有时为-1
+	 * @param ec 错误码
+	 * @return
+	 */
+	static void receive_fd(int socket, void *data, size_t size, int &fd, boost::system::error_code &ec) {
+		fd = -1;
+		size_t received = 0;
+		while (received < size) {
+			iovec iov{ static_cast<char *>(data) + received, size - received };
+			alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr msg{};
+			msg.msg_iov = &iov;
+			msg.msg_iovlen = 1;
+			msg.msg_control = control;
+			msg.msg_controllen = sizeof(control);
+			ssize_t n = ::recvmsg(socket, &msg, MSG_CMSG_CLOEXEC);
+			if (n <= 0) {
+				if (n < 0 && errno == EINTR)
+					continue;
+				ec = n < 0 ? boost::system::error_code(errno, boost::system::system_category())
+						   : boost::asio::error::eof;
+				break;
+			}
+			for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+				if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS && fd < 0)
+					std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+			}
+			received += size_t(n);
+		}
+		if (received == size)
+			ec = boost::system::error_code();
+		else if (fd >= 0) {
+			::close(fd);
+			fd = -1;
+		}
+	}
+
+	shm_ring client_to_server() {
+		return shm_ring(ring_header(0), ring_data(0), ring_size_);
+	}
+
+	shm_ring server_to_client() {
+		return shm_ring(ring_header(1), ring_data(1), ring_size_);
+	}
+
+private:
+	enum : uint32_t { magic = 0x43485348, version = 1 };
+
+	struct control_block {
+		uint32_t magic;
+		uint32_t version;
+		uint64_t ring_size;
+	};
+
+	//布局: 控制块 | 环0控制块 | 环1控制块 | 环0数据 | 环1数据
+	static size_t header_offset(int index) {
+		return 64 + size_t(index) * sizeof(shm_ring_header);
+	}
+
+	static size_t data_offset(int index, size_t ring_size) {
+		return header_offset(2) + size_t(index) * ring_size;
+	}
+
+	static size_t total_size(size_t ring_size) {
+		return data_offset(2, ring_size);
+	}
+
+	bool map(int fd, size_t size) {
+		void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (base == MAP_FAILED)
+			return false;
+		base_ = static_cast<char *>(base);
+		size_ = size;
+		return true;
+	}
+
+	control_block *control() {
+		return reinterpret_cast<control_block *>(base_);
+	}
+
+	shm_ring_header *ring_header(int index) {
+		return reinterpret_cast<shm_ring_header *>(base_ + header_offset(index));
+	}
+
+	char *ring_data(int index) {
+		return base_ + data_offset(index, ring_size_);
+	}
+
+private:
+	char *base_ = nullptr;
+	size_t size_ = 0;
+	size_t ring_size_ = 0;
+	//服务端创建后、传给客户端前持有的描述符
+	int fd_ = -1;
+};
+
+/**
+ * @brief 基于共享内存环的流,提供与socket相同的async_read_some/async_write_some接口,
+ *        可以直接用于chat_session和boost::asio::async_write
+ *        数据走共享内存,Unix域socket只用来传递门铃字节:
+ *        环由空变为非空或由满变为不满且对方在等待时,才写一个字节唤醒对方
+ */
+class shm_stream {
+public:
+	using socket_type = boost::asio::local::stream_protocol::socket;
+	using executor_type = socket_type::executor_type;
+
+	/**
+	 * @brief 构造
+	 * @param io_service
+	 * @param doorbell 用于门铃的Unix域socket
+	 * @param segment 共享内存段
+	 * @param server_side 服务端读client_to_server环,客户端相反
+	 * @return 本类对象
+	 */
+	shm_stream(boost::asio::io_service &io_service, socket_type doorbell,
+			   shm_segment segment, bool server_side)
+		: state_(std::make_shared<state>(io_service, std::move(doorbell), std::move(segment), server_side)) {
+		state_->arm_doorbell();
+	}
+
+	executor_type get_executor() {
+		return state_->doorbell_.get_executor();
+	}
+
+	template <typename MutableBufferSequence, typename ReadHandler>
+	void async_read_some(const MutableBufferSequence &buffers, ReadHandler &&handler) {
+		std::vector<boost::asio::mutable_buffer> copy(
+			boost::asio::buffer_sequence_begin(buffers), boost::asio::buffer_sequence_end(buffers));
+		std::function<void(boost::system::error_code, size_t)> callback(std::forward<ReadHandler>(handler));
+		auto s = state_;
+		s->strand_.dispatch([s, copy, callback]() mutable {
+			s->read_buffers_ = std::move(copy);
+			s->read_handler_ = std::move(callback);
+			s->try_read();
+		});
+	}
+
+	template <typename ConstBufferSequence, typename WriteHandler>
+	void async_write_some(const ConstBufferSequence &buffers, WriteHandler &&handler) {
+		std::vector<boost::asio::const_buffer> copy(
+			boost::asio::buffer_sequence_begin(buffers), boost::asio::buffer_sequence_end(buffers));
+		std::function<void(boost::system::error_code, size_t)> callback(std::forward<WriteHandler>(handler));
+		auto s = state_;
+		s->strand_.dispatch([s, copy, callback]() mutable {
+			s->write_buffers_ = std::move(copy);
+			s->write_handler_ = std::move(callback);
+			s->try_write();
+		});
+	}
+
+	void close(boost::system::error_code &ec) {
+		auto s = state_;
+		s->strand_.dispatch([s]() {
+			boost::system::error_code ignored;
+			s->doorbell_.close(ignored);
+		});
+		ec = boost::system::error_code();
+	}
+
+	void close() {
+		boost::system::error_code ec;
+		close(ec);
+	}
+
+private:
+	using handler_type = std::function<void(boost::system::error_code, size_t)>;
+
+	struct state : std::enable_shared_from_this<state> {
+		state(boost::asio::io_service &io_service, socket_type doorbell, shm_segment segment, bool server_side)
+			: io_service_(io_service), strand_(io_service), doorbell_(std::move(doorbell)),
+			  segment_(std::move(segment)),
+			  rx_(server_side ? segment_.client_to_server() : segment_.server_to_client()),
+			  tx_(server_side ? segment_.server_to_client() : segment_.client_to_server()) {
+			doorbell_.non_blocking(true);
+		}
+
+		void arm_doorbell() {
+			auto self = shared_from_this();
+			doorbell_.async_read_some(boost::asio::buffer(doorbell_buffer_),
+				strand_.wrap([self](boost::system::error_code ec, size_t) {
+					if (ec) {
+						self->error_ = ec;
+						self->try_read();
+						self->try_write();
+						return;
+					}
+					self->try_read();
+					self->try_write();
+					self->arm_doorbell();
+				}));
+		}
+
+		void ring_doorbell() {
+			char bell = 1;
+			boost::system::error_code ec;
+			//门铃已经堆积在socket里时对方一定会醒来,would_block可以忽略
+			doorbell_.send(boost::asio::buffer(&bell, 1), 0, ec);
+		}
+
+		void try_read() {
+			if (!read_handler_)
+				return;
+			if (boost::asio::buffer_size(read_buffers_) == 0) {
+				complete(read_handler_, boost::system::error_code(), 0);
+				return;
+			}
+			boost::system::error_code ec;
+			size_t n = rx_.read_some(read_buffers_, ec);
+			if (ec) {
+				fail(ec);
+				complete(read_handler_, error_, 0);
+				return;
+			}
+			if (n > 0) {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (rx_.header()->writer_waiting.exchange(0))
+					ring_doorbell();
+				complete(read_handler_, boost::system::error_code(), n);
+				return;
+			}
+			if (error_) {
+				complete(read_handler_, error_, 0);
+				return;
+			}
+			rx_.header()->reader_waiting.store(1);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (rx_.readable() > 0) {
+				rx_.header()->reader_waiting.store(0);
+				try_read();
+			}
+		}
+
+		void try_write() {
+			if (!write_handler_)
+				return;
+			if (error_) {
+				complete(write_handler_, boost::asio::error::broken_pipe, 0);
+				return;
+			}
+			boost::system::error_code ec;
+			size_t n = tx_.write_some(write_buffers_, ec);
+			if (ec) {
+				fail(ec);
+				complete(write_handler_, error_, 0);
+				return;
+			}
+			if (n > 0 || boost::asio::buffer_size(write_buffers_) == 0) {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (tx_.header()->reader_waiting.exchange(0))
+					ring_doorbell();
+				complete(write_handler_, boost::system::error_code(), n);
+				return;
+			}
+			tx_.header()->writer_waiting.store(1);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (tx_.writable() > 0) {
+				tx_.header()->writer_waiting.store(0);
+				try_write();
+			}
+		}
+
+		/**
+		 * @brief 对方改坏了控制块: 之后的读写都失败,关闭门铃让对方知道连接已断开
+		 * @param ec 错误码
+		 * @return
+		 */
+		void fail(boost::system::error_code ec) {
+			error_ = ec;
+			boost::system::error_code ignored;
+			doorbell_.close(ignored);
+		}
+
+		void complete(handler_type &handler, boost::system::error_code ec, size_t n) {
+			handler_type callback(std::move(handler));
+			handler = nullptr;
+			io_service_.post([callback, ec, n]() { callback(ec, n); });
+		}
+
+		boost::asio::io_service &io_service_;
+		boost::asio::io_service::strand strand_;
+		socket_type doorbell_;
+		shm_segment segment_;
+		shm_ring rx_;
+		shm_ring tx_;
+		char doorbell_buffer_[64];
+		boost::system::error_code error_;
+		std::vector<boost::asio::mutable_buffer> read_buffers_;
+		handler_type read_handler_;
+		std::vector<boost::asio::const_buffer> write_buffers_;
+		handler_type write_handler_;
+	};
+
+	std::shared_ptr<state> state_;
+};
+
+#endif
@@ -0,0 +1,306 @@
+﻿#pragma once
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief slot_map中元素的句柄,槽位被释放后代数加一,旧句柄随即失效
+ */
+struct slot_handle {
+	enum : uint32_t { invalid_index = 0xffffffff };
+
+	uint32_t index = invalid_index;
+	uint32_t generation = 0;
+
+	bool valid() const {
+		return index != invalid_index;
+	}
+};
+
+/**
+ * @brief 元素连续存放的slot_map,插入和删除O(1),删除时用最后一个元素填补空位,
+ *        遍历是对连续数组的顺序访问,元素没有单独的堆节点
+ */
+template <typename T>
+class slot_map {
+public:
+	using iterator = typename std::vector<T>::iterator;
+	using const_iterator = typename std::vector<T>::const_iterator;
+
+	/**
+	 * @brief 插入一个元素
+	 * @param value 元素
+	 * @return slot_handle 元素的句柄
+	 */
+	slot_handle insert(T value) {
+		uint32_t index;
+		if (free_head_ != slot_handle::invalid_index) {
+			index = free_head_;
+			free_head_ = slots_[index].dense;
+		}
+		else {
+			index = uint32_t(slots_.size());
+			slots_.push_back(slot());
+		}
+		slots_[index].dense = uint32_t(values_.size());
+		values_.push_back(std::move(value));
+		dense_to_slot_.push_back(index);
+		return slot_handle{ index, slots_[index].generation };
+	}
+
+	/**
+	 * @brief 删除句柄对应的元素,句柄已失效时什么也不做
+	 * @param handle 句柄
+	 * @return bool 是否删除了元素
+	 */
+	bool erase(slot_handle handle) {
+		if (!contains(handle))
+			return false;
+		uint32_t dense = slots_[handle.index].dense;
+		uint32_t last = uint32_t(values_.size() - 1);
+		if (dense != last) {
+			values_[dense] = std::move(values_[last]);
+			dense_to_slot_[dense] = dense_to_slot_[last];
+			slots_[dense_to_slot_[dense]].dense = dense;
+		}
+		values_.pop_back();
+		dense_to_slot_.pop_back();
+
+		auto &s = slots_[handle.index];
+		++s.generation;
+		s.dense = free_head_;
+		free_head_ = handle.index;
+		return true;
+	}
+
+	/**
+	 * @brief 取句柄对应的元素
+	 * @param handle 句柄
+	 * @return T* 句柄已失效时返回nullptr
+	 */
+	T *get(slot_handle handle) {
+		return contains(handle) ? &values_[slots_[handle.index].dense] : nullptr;
+	}
+
+	const T *get(slot_handle handle) const {
+		return contains(handle) ? &values_[slots_[handle.index].dense] : nullptr;
+	}
+
+	bool contains(slot_handle handle) const {
+		if (handle.index >= slots_.size())
+			return false;
+		const auto &s = slots_[handle.index];
+		//空闲槽位的dense是空闲链表的下一项,需要反查确认槽位在用
+		return s.generation == handle.generation && s.dense < dense_to_slot_.size() &&
+			   dense_to_slot_[s.dense] == handle.index;
+	}
+
+	void clear() {
+		values_.clear();
+		dense_to_slot_.clear();
+		slots_.clear();
+		free_head_ = slot_handle::invalid_index;
+	}
+
+	iterator begin() {
+		return values_.begin();
+	}
+
+	iterator end() {
+		return values_.end();
+	}
+
+	const_iterator begin() const {
+		return values_.begin();
+	}
+
+	const_iterator end() const {
+		return values_.end();
+	}
+
+	size_t size() const {
+		return values_.size();
+	}
+
+	bool empty() const {
+		return values_.empty();
+	}
+
+private:
+	struct slot {
+		//在用时是values_中的下标,空闲时是空闲链表的下一个槽位
+		uint32_t dense = 0;
+		uint32_t generation = 0;
+	};
+
+	std::vector<T> values_;
+	std::vector<uint32_t> dense_to_slot_;
+	std::vector<slot> slots_;
+	uint32_t free_head_ = slot_handle::invalid_index;
+};
+
+/**
+ * @brief 以shared_ptr指向的对象为键的slot_map,另有一张开放寻址的索引表按指针查找句柄,
+ *        索引表也是连续数组,插入、查找、删除都是O(1)且没有单独的堆节点
+ */
+template <typename Key, typename Value = bool>
+class ptr_slot_map {
+public:
+	struct entry {
+		std::shared_ptr<Key> key;
+		Value value;
+	};
+
+	using iterator = typename slot_map<entry>::iterator;
+	using const_iterator = typename slot_map<entry>::const_iterator;
+
+	/**
+	 * @brief 插入,键已存在时不修改
+	 * @param key 键
+	 * @param value 值
+	 * @return pair<slot_handle, bool> 元素的句柄,是否新插入
+	 */
+	std::pair<slot_handle, bool> insert(const std::shared_ptr<Key> &key, Value value = Value()) {
+		size_t pos = find_pos(key.get());
+		if (pos != npos)
+			return std::make_pair(index_[pos].handle, false);
+		reserve_index(entries_.size() + 1);
+		auto handle = entries_.insert(entry{ key, std::move(value) });
+		place(key.get(), handle);
+		return std::make_pair(handle, true);
+	}
+
+	/**
+	 * @brief 按键删除
+	 * @param key 键
+	 * @return bool 是否删除了元素
+	 */
+	bool erase(const Key *key) {
+		size_t pos = find_pos(key);
+		if (pos == npos)
+			return false;
+		entries_.erase(index_[pos].handle);
+		remove_at(pos);
+		return true;
+	}
+
+	/**
+	 * @brief 按句柄删除,句柄已失效时什么也不做
+	 * @param handle 句柄
+	 * @return bool 是否删除了元素
+	 */
+	bool erase(slot_handle handle) {
+		auto e = entries_.get(handle);
+		return e ? erase(e->key.get()) : false;
+	}
+
+	entry *find(const Key *key) {
+		size_t pos = find_pos(key);
+		return pos == npos ? nullptr : entries_.get(index_[pos].handle);
+	}
+
+	entry *get(slot_handle handle) {
+		return entries_.get(handle);
+	}
+
+	iterator begin() {
+		return entries_.begin();
+	}
+
+	iterator end() {
+		return entries_.end();
+	}
+
+	const_iterator begin() const {
+		return entries_.begin();
+	}
+
+	const_iterator end() const {
+		return entries_.end();
+	}
+
+	size_t size() const {
+		return entries_.size();
+	}
+
+	bool empty() const {
+		return entries_.empty();
+	}
+
+private:
+	enum : size_t { npos = size_t(-1) };
+
+	struct index_entry {
+		const Key *key = nullptr;
+		slot_handle handle;
+	};
+
+	size_t bucket(const Key *key) const {
+		uint64_t h = uint64_t(uintptr_t(key)) * 0x9E3779B97F4A7C15ull;
+		return size_t(h >> 32) & (index_.size() - 1);
+	}
+
+	size_t find_pos(const Key *key) const {
+		if (index_.empty())
+			return npos;
+		size_t mask = index_.size() - 1;
+		for (size_t i = bucket(key);; i = (i + 1) & mask) {
+			if (index_[i].key == key)
+				return i;
+			if (!index_[i].key)
+				return npos;
+		}
+	}
+
+	void place(const Key *key, slot_handle handle) {
+		size_t mask = index_.size() - 1;
+		size_t i = bucket(key);
+		while (index_[i].key)
+			i = (i + 1) & mask;
+		index_[i].key = key;
+		index_[i].handle = handle;
+	}
+
+	/**
+	 * @brief 保持索引表的装载率不超过一半
+	 * @param count 需要容纳的元素数
+	 * @return
+	 */
+	void reserve_index(size_t count) {
+		if (count * 2 <= index_.size())
+			return;
+		size_t capacity = index_.empty() ? 16 : index_.size() * 2;
+		while (capacity < count * 2)
+			capacity *= 2;
+		std::vector<index_entry> old(capacity);
+		old.swap(index_);
+		for (const auto &e : old) {
+			if (e.key)
+				place(e.key, e.handle);
+		}
+	}
+
+	/**
+	 * @brief 线性探测的删除,把后面探测链上的项前移填补空位,不使用墓碑
+	 * @param pos 被删除项的位置
+	 * @return
+	 */
+	void remove_at(size_t pos) {
+		size_t mask = index_.size() - 1;
+		size_t hole = pos;
+		for (size_t i = (pos + 1) & mask; index_[i].key; i = (i + 1) & mask) {
+			size_t home = bucket(index_[i].key);
+			//空位在该项的初始位置和当前位置之间时才能前移
+			if (((i - home) & mask) >= ((i - hole) & mask)) {
+				index_[hole] = index_[i];
+				hole = i;
+			}
+		}
+		index_[hole] = index_entry();
+	}
+
+private:
+	slot_map<entry> entries_;
+	std::vector<index_entry> index_;
+};
@@ -2,6 +2,7 @@
 #include "serialize_object.h"
 #include "json_object.h"
 #include "protocol.pb.h"
+#include "flat_message.h"
 #include <cstdlib>
 #include <cstring>
 #include <string>
@@ -179,5 +180,208 @@ bool parse_message4(const std::string &input, int *type, std::string &outbuffer)
 			*type = MT_CHAT_INFO;
 		return ok;
 	}
+	else if (command == "JoinRoom" || command == "LeaveRoom") {
+		//"JoinRoom 42",续传时带上最后收到的序号"JoinRoom 42 1000"
+		char *end = nullptr;
+		auto room_id = std::strtoull(input.c_str() + pos + 1, &end, 10);
+		if (end == input.c_str() + pos + 1)
+			return false;
+		uint64_t last_seq = 0;
+		if (command == "JoinRoom" && *end == ' ') {
+			const char *seq_begin = end + 1;
+			last_seq = std::strtoull(seq_begin, &end, 10);
+			if (end == seq_begin)
+				return false;
+		}
+		if (*end != '\0')
+			return false;
+		bool ok;
+		if (command == "JoinRoom") {
+			PJoinRoom join;
+			join.set_room_id(room_id);
+			join.set_last_seq(last_seq);
+			ok = join.SerializeToString(&outbuffer);
+		}
+		else {
+			PLeaveRoom leave;
+			leave.set_room_id(room_id);
+			ok = leave.SerializeToString(&outbuffer);
+		}
+		if (type)
+			*type = command == "JoinRoom" ? MT_JOIN_ROOM : MT_LEAVE_ROOM;
+		return ok;
+	}
+	else if (command == "RoomChat") {
+		//"RoomChat 42 hello"
+		char *end = nullptr;
+		auto room_id = std::strtoull(input.c_str() + pos + 1, &end, 10);
+		if (end == input.c_str() + pos + 1 || *end != ' ')
+			return false;
+		std::string chat(end + 1);
+		if (chat.size() > 256)
+			return false;
+		PRoomChat room_chat;
+		room_chat.set_room_id(room_id);
+		room_chat.set_information(chat);
+		auto ok = room_chat.SerializeToString(&outbuffer);
+		if (type)
+			*type = MT_ROOM_CHAT;
+		return ok;
+	}
+	else if (command == "Direct") {
+		//"Direct alice hello"
+		auto name_end = input.find(' ', pos + 1);
+		if (name_end == std::string::npos || name_end == pos + 1)
+			return false;
+		std::string chat = input.substr(name_end + 1);
+		if (chat.size() > 256)
+			return false;
+		PDirectChat direct;
+		direct.set_to(input.substr(pos + 1, name_end - pos - 1));
+		direct.set_information(chat);
+		auto ok = direct.SerializeToString(&outbuffer);
+		if (type)
+			*type = MT_DIRECT_CHAT;
+		return ok;
+	}
 	return false;
 }
+
+/**
+ * @brief 使用flat布局将用户输入解析并存放到outbuffer中
+ * @param input 用户输入
+ * @param type 用户输入的类型
+ * @param outbuffer 输出
+ * @return bool 是否解析成功
+ */
+bool parse_message5(const std::string &input, int *type, std::string &outbuffer) {
+	auto pos = input.find_first_of(" ");
+	if (pos == std::string::npos)
+		return false;
+	if (pos == 0)
+		return false;
+	auto command = input.substr(0, pos);
+	if (command == "BindName") {
+		std::string name = input.substr(pos + 1);
+		if (name.size() > 32)
+			return false;
+		outbuffer.resize(flat_builder::body_size(flat_bind_name::field_count, name.size()));
+		flat_builder builder(&outbuffer[0], flat_bind_name::field_count);
+		builder.set_string(flat_bind_name::name, name);
+		if (type)
+			*type = MT_BIND_NAME;
+		return true;
+	}
+	else if (command == "Chat" || command == "RoomChat") {
+		//"Chat hello"或"RoomChat 42 hello"
+		uint64_t room_id = 0;
+		const char *chat_begin = input.c_str() + pos + 1;
+		if (command == "RoomChat") {
+			char *end = nullptr;
+			room_id = std::strtoull(chat_begin, &end, 10);
+			if (end == chat_begin || *end != ' ')
+				return false;
+			chat_begin = end + 1;
+		}
+		std::string chat(chat_begin);
+		if (chat.size() > 256)
+			return false;
+		outbuffer.resize(flat_builder::body_size(flat_chat::field_count, chat.size()));
+		flat_builder builder(&outbuffer[0], flat_chat::field_count);
+		builder.set_string(flat_chat::information, chat);
+		builder.set_uint(flat_chat::room_id, room_id);
+		if (type)
+			*type = command == "Chat" ? MT_CHAT_INFO : MT_ROOM_CHAT;
+		return true;
+	}
+	else if (command == "JoinRoom" || command == "LeaveRoom") {
+		//"JoinRoom 42",续传时带上最后收到的序号"JoinRoom 42 1000"
+		char *end = nullptr;
+		auto room_id = std::strtoull(input.c_str() + pos + 1, &end, 10);
+		if (end == input.c_str() + pos + 1)
+			return false;
+		uint64_t last_seq = 0;
+		if (command == "JoinRoom" && *end == ' ') {
+			const char *seq_begin = end + 1;
+			last_seq = std::strtoull(seq_begin, &end, 10);
+			if (end == seq_begin)
+				return false;
+		}
+		if (*end != '\0')
+			return false;
+		outbuffer.resize(flat_builder::body_size(flat_join_room::field_count, 0));
+		flat_builder builder(&outbuffer[0], flat_join_room::field_count);
+		builder.set_uint(flat_join_room::room_id, room_id);
+		builder.set_uint(flat_join_room::last_seq, last_seq);
+		if (type)
+			*type = command == "JoinRoom" ? MT_JOIN_ROOM : MT_LEAVE_ROOM;
+		return true;
+	}
+	else if (command == "Direct") {
+		//"Direct alice hello"
+		auto name_end = input.find(' ', pos + 1);
+		if (name_end == std::string::npos || name_end == pos + 1)
+			return false;
+		std::string chat = input.substr(name_end + 1);
+		if (chat.size() > 256)
+			return false;
+		std::string to = input.substr(pos + 1, name_end - pos - 1);
+		outbuffer.resize(flat_builder::body_size(flat_direct_chat::field_count, to.size() + chat.size()));
+		flat_builder builder(&outbuffer[0], flat_direct_chat::field_count);
+		builder.set_string(flat_direct_chat::to, to);
+		builder.set_string(flat_direct_chat::information, chat);
+		if (type)
+			*type = MT_DIRECT_CHAT;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * @brief 按编码把用户输入解析并存放到outbuffer中
+ * @param codec 编码,CodecType之一
+ * @param input 用户输入
+ * @param type 用户输入的类型
+ * @param outbuffer 输出
+ * @return bool 是否解析成功,未知的编码返回false
+ */
+bool parse_message_as(int codec, const std::string &input, int *type, std::string &outbuffer) {
+	switch (codec) {
+	case CODEC_RAW:
+		return parse_message(input, type, outbuffer);
+	case CODEC_TEXT:
+		return parse_message2(input, type, outbuffer);
+	case CODEC_JSON:
+		return parse_message3(input, type, outbuffer);
+	case CODEC_PROTOBUF:
+		return parse_message4(input, type, outbuffer);
+	case CODEC_FLAT:
+		return parse_message5(input, type, outbuffer);
+	default:
+		return false;
+	}
+}
+
+static const char *const codec_names[] = { "unknown", "raw", "text", "json", "protobuf", "flat" };
+
+/**
+ * @brief 编码的名字
+ * @param codec 编码,CodecType之一
+ * @return const char* 未知的编码返回"unknown"
+ */
+const char *codec_name(int codec) {
+	return codec >= CODEC_RAW && codec <= CODEC_FLAT ? codec_names[codec] : codec_names[0];
+}
+
+/**
+ * @brief 按名字查找编码
+ * @param name raw/text/json/protobuf/flat
+ * @return int CodecType之一,未知的名字返回0
+ */
+int codec_from_name(const std::string &name) {
+	for (int codec = CODEC_RAW; codec <= CODEC_FLAT; ++codec) {
+		if (name == codec_names[codec])
+			return codec;
+	}
+	return 0;
+}
@@ -11,6 +11,36 @@ enum MessageType {
 	MT_BIND_NAME = 1,
 	MT_CHAT_INFO = 2,
 	MT_ROOM_INFO = 3,
+	//本机共享内存传输的握手,客户端的消息体为希望的环容量,服务端的回复附带共享内存段的描述符
+	MT_SHM_ATTACH = 4,
+	//加入/离开指定房间,向指定房间发言
+	MT_JOIN_ROOM = 5,
+	MT_LEAVE_ROOM = 6,
+	MT_ROOM_CHAT = 7,
+	//续传时缺口已超出房间保留的历史,随后是完整的历史重放
+	MT_RESYNC_TOO_FAR = 8,
+	//私聊,按名字直接投递给一个客户端,不经过房间
+	MT_DIRECT_CHAT = 9,
+	MT_DIRECT_INFO = 10,
+	//集群节点之间的链路:握手、订阅/退订房间、转发房间广播,客户端连接上收到时忽略
+	MT_NODE_HELLO = 11,
+	MT_NODE_SUBSCRIBE = 12,
+	MT_NODE_UNSUBSCRIBE = 13,
+	MT_NODE_RELAY = 14,
+	//编码协商: 客户端连接后的第一帧列出它支持的编码(每字节一个CodecType,按偏好排列),
+	//服务端回复选中的编码(一个字节),之后双方都使用该编码;不协商的客户端使用protobuf
+	MT_CODEC_HELLO = 15,
+	MT_CODEC_SELECT = 16,
+};
+
+//客户端消息体的编码,依次对应parse_message、parse_message2、parse_message3、parse_message4、parse_message5
+enum CodecType {
+	CODEC_RAW = 1,
+	CODEC_TEXT = 2,
+	CODEC_JSON = 3,
+	CODEC_PROTOBUF = 4,
+	//按偏移原地读取的定长布局,见flat_message.h
+	CODEC_FLAT = 5,
 };
 
 struct BindName {
@@ -64,3 +94,36 @@ bool parse_message3(const std::string &input, int *type, std::string &outbuffer)
  * @return bool 是否解析成功
  */
 bool parse_message4(const std::string &input, int *type, std::string &outbuffer);
+
+/**
+ * @brief 使用flat布局将用户输入解析并存放到outbuffer中
+ * @param input 用户输入
+ * @param type 用户输入的类型
+ * @param outbuffer 输出
+ * @return bool 是否解析成功
+ */
+bool parse_message5(const std::string &input, int *type, std::string &outbuffer);
+
+/**
+ * @brief 按编码把用户输入解析并存放到outbuffer中
+ * @param codec 编码,CodecType之一
+ * @param input 用户输入
+ * @param type 用户输入的类型
+ * @param outbuffer 输出
+ * @return bool 是否解析成功,未知的编码返回false
+ */
+bool parse_message_as(int codec, const std::string &input, int *type, std::string &outbuffer);
+
+/**
+ * @brief 编码的名字
+ * @param codec 编码,CodecType之一
+ * @return const char* 未知的编码返回"unknown"
+ */
+const char *codec_name(int codec);
+
+/**
+ * @brief 按名字查找编码
+ * @param name raw/text/json/protobuf/flat
+ * @return int CodecType之一,未知的名字返回0
+ */
+int codec_from_name(const std::string &name);
@@ -0,0 +1,637 @@
+﻿#include "uring_server.h"
+#include <stdexcept>
+
+#ifdef CHAT_SERVER_IO_URING
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <liburing.h>
+#include "chat_room.h"
+#include "chat_handler.h"
+#include "receive_buffer.h"
+#include "server_stats.h"
+#include "send_queue.h"
+
+namespace {
+
+//user_data的低8位为操作类型,其余为连接id
+enum uring_op {
+	op_accept = 1,
+	op_recv = 2,
+	op_send = 3,
+	op_wakeup = 4,
+};
+
+inline __u64 make_user_data(uint64_t id, uring_op op) {
+	return (id << 8) | op;
+}
+
+/**
+ * @brief 创建SO_REUSEPORT的监听socket
+ * @param port 监听端口
+ * @return int 成功返回fd,失败返回-errno
+ */
+int open_listener(int port) {
+	int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+		return -errno;
+	int on = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on));
+	sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(static_cast<uint16_t>(port));
+	if (bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 ||
+		listen(fd, SOMAXCONN) < 0) {
+		int err = errno;
+		close(fd);
+		return -err;
+	}
+	return fd;
+}
+
+}
+
+class uring_server::impl {
+public:
+	/**
+	 * @brief io_uring上的一个客户端连接,所有成员只在事件循环线程访问,deliver除外
+	 */
+	class connection :
+		public chat_participant,
+		public std::enable_shared_from_this<connection> {
+	public:
+		connection(impl &server, uint64_t id, int fd, room_registry &rooms, session_directory &names,
+				   const send_queue_options &queue_options)
+			: server_(server), id_(id), fd_(fd), handler_(rooms, names), write_msgs_(queue_options) {
+		}
+
+		/**
+		 * @brief 由房间strand调用,转交给事件循环线程发送
+		 * @param msg 编码好的共享消息帧
+		 * @return
+		 */
+		void deliver(const chat_message_ptr &msg) override {
+			server_.post(id_, msg);
+		}
+
+		/**
+		 * @brief 整批转交给事件循环线程,只唤醒一次
+		 * @param batch 共享的消息批
+		 * @return
+		 */
+		void deliver(const chat_message_batch_ptr &batch) override {
+			server_.post(id_, *batch);
+		}
+
+		impl &server_;
+		uint64_t id_;
+		int fd_;
+		chat_handler handler_;
+		receive_buffer read_buffer_;
+		send_queue write_msgs_;
+		//队首消息已经发送的字节数,sendmsg可能只发送一部分
+		size_t front_offset_ = 0;
+		std::vector<iovec> iovecs_;
+		msghdr msg_hdr_;
+		bool recv_armed_ = false;
+		bool send_in_flight_ = false;
+		bool send_pending_ = false;
+		bool closing_ = false;
+	};
+
+	using connection_ptr = std::shared_ptr<connection>;
+
+	impl(room_registry &rooms, session_directory &names, int port, int server_id, const server_config &config)
+		: rooms_(rooms), names_(names), queue_options_(config.queue), server_id_(server_id) {
+		int ret = io_uring_queue_init(queue_depth, &ring_, 0);
+		if (ret < 0)
+			throw std::runtime_error(std::string("io_uring_queue_init: ") + strerror(-ret));
+		listen_fd_ = open_listener(port);
+		if (listen_fd_ < 0) {
+			io_uring_queue_exit(&ring_);
+			throw std::runtime_error(std::string("listen: ") + strerror(-listen_fd_));
+		}
+		event_fd_ = eventfd(0, EFD_CLOEXEC);
+		if (event_fd_ < 0) {
+			int err = errno;
+			close(listen_fd_);
+			io_uring_queue_exit(&ring_);
+			throw std::runtime_error(std::string("eventfd: ") + strerror(err));
+		}
+		setup_buffer_ring();
+		multishot_recv_ = buf_ring_ != nullptr;
+		std::cout << "uring server " << server_id_ << " start!"
+				  << (buf_ring_ ? " (provided buffers)" : "") << std::endl;
+	}
+
+	~impl() {
+		for (auto &item : connections_)
+			close(item.second->fd_);
+		connections_.clear();
+		if (buf_ring_) {
+			io_uring_unregister_buf_ring(&ring_, buffer_group);
+			munmap(buf_ring_, buffer_count * sizeof(io_uring_buf));
+		}
+		close(event_fd_);
+		close(listen_fd_);
+		io_uring_queue_exit(&ring_);
+	}
+
+	/**
+	 * @brief 事件循环,每次提交所有sqe并批量处理完成事件
+	 * @param
+	 * @return
+	 */
+	void run() {
+		arm_accept();
+		arm_wakeup();
+		io_uring_cqe *cqes[batch_cqes];
+		while (!stopped_.load(std::memory_order_acquire)) {
+			int ret = io_uring_submit_and_wait(&ring_, 1);
+			if (ret < 0 && ret != -EINTR && ret != -EBUSY) {
+				std::cerr << "io_uring_submit_and_wait: " << strerror(-ret) << std::endl;
+				break;
+			}
+			unsigned count = io_uring_peek_batch_cqe(&ring_, cqes, batch_cqes);
+			for (unsigned i = 0; i < count; ++i)
+				handle_cqe(cqes[i]);
+			io_uring_cq_advance(&ring_, count);
+		}
+	}
+
+	void stop() {
+		stopped_.store(true, std::memory_order_release);
+		wakeup();
+	}
+
+	/**
+	 * @brief 将消息放入收件箱并唤醒事件循环,可在任意线程调用
+	 * @param id 连接id
+	 * @param msg 编码好的共享消息帧
+	 * @return
+	 */
+	void post(uint64_t id, const chat_message_ptr &msg) {
+		bool need_wakeup = false;
+		{
+			std::lock_guard<std::mutex> lock(inbox_mutex_);
+			inbox_.emplace_back(id, msg);
+			need_wakeup = !wakeup_pending_;
+			wakeup_pending_ = true;
+		}
+		if (need_wakeup)
+			wakeup();
+	}
+
+	/**
+	 * @brief 将一批消息放入收件箱并唤醒事件循环,可在任意线程调用
+	 * @param id 连接id
+	 * @param batch 消息批
+	 * @return
+	 */
+	void post(uint64_t id, const chat_message_batch &batch) {
+		bool need_wakeup = false;
+		{
+			std::lock_guard<std::mutex> lock(inbox_mutex_);
+			for (const auto &msg : batch)
+				inbox_.emplace_back(id, msg);
+			need_wakeup = !wakeup_pending_;
+			wakeup_pending_ = true;
+		}
+		if (need_wakeup)
+			wakeup();
+	}
+
+private:
+	enum { queue_depth = 4096 };
+	enum { batch_cqes = 256 };
+	//provided buffer ring,每个reactor 1024个4K的接收缓冲区
+	enum { buffer_group = 0 };
+	enum { buffer_count = 1024 };
+	enum { buffer_size = 4 * 1024 };
+	//单次sendmsg的上限,与chat_session的gather write一致
+	enum { max_send_iovecs = 64 };
+	enum { max_send_bytes = 64 * 1024 };
+
+	void wakeup() {
+		uint64_t one = 1;
+		ssize_t n = write(event_fd_, &one, sizeof(one));
+		(void)n;
+	}
+
+	/**
+	 * @brief 注册provided buffer ring,内核不支持时recv直接读入连接的接收缓冲区
+	 * @param
+	 * @return
+	 */
+	void setup_buffer_ring() {
+		size_t ring_bytes = buffer_count * sizeof(io_uring_buf);
+		void *mem = mmap(nullptr, ring_bytes, PROT_READ | PROT_WRITE,
+						 MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+		if (mem == MAP_FAILED)
+			return;
+		io_uring_buf_reg reg;
+		memset(&reg, 0, sizeof(reg));
+		reg.ring_addr = reinterpret_cast<unsigned long>(mem);
+		reg.ring_entries = buffer_count;
+		reg.bgid = buffer_group;
+		if (io_uring_register_buf_ring(&ring_, &reg, 0) != 0) {
+			munmap(mem, ring_bytes);
+			return;
+		}
+		buf_ring_ = static_cast<io_uring_buf_ring *>(mem);
+		io_uring_buf_ring_init(buf_ring_);
+		buffers_.resize(size_t(buffer_count) * buffer_size);
+		for (int i = 0; i < buffer_count; ++i) {
+			io_uring_buf_ring_add(buf_ring_, buffers_.data() + size_t(i) * buffer_size, buffer_size,
+								  static_cast<unsigned short>(i), io_uring_buf_ring_mask(buffer_count), i);
+		}
+		io_uring_buf_ring_advance(buf_ring_, buffer_count);
+	}
+
+	/**
+	 * @brief 将用完的接收缓冲区还给内核
+	 * @param bid 缓冲区id
+	 * @return
+	 */
+	void recycle_buffer(unsigned bid) {
+		io_uring_buf_ring_add(buf_ring_, buffers_.data() + size_t(bid) * buffer_size, buffer_size,
+							  static_cast<unsigned short>(bid), io_uring_buf_ring_mask(buffer_count), 0);
+		io_uring_buf_ring_advance(buf_ring_, 1);
+	}
+
+	io_uring_sqe *get_sqe() {
+		auto sqe = io_uring_get_sqe(&ring_);
+		if (!sqe) {
+			io_uring_submit(&ring_);
+			sqe = io_uring_get_sqe(&ring_);
+			if (!sqe)
+				throw std::runtime_error("io_uring submission queue is full");
+		}
+		return sqe;
+	}
+
+	void arm_accept() {
+		auto sqe = get_sqe();
+		if (multishot_accept_)
+			io_uring_prep_multishot_accept(sqe, listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+		else
+			io_uring_prep_accept(sqe, listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+		io_uring_sqe_set_data64(sqe, make_user_data(0, op_accept));
+	}
+
+	void arm_wakeup() {
+		auto sqe = get_sqe();
+		io_uring_prep_read(sqe, event_fd_, &event_value_, sizeof(event_value_), 0);
+		io_uring_sqe_set_data64(sqe, make_user_data(0, op_wakeup));
+	}
+
+	void arm_recv(connection &c) {
+		auto sqe = get_sqe();
+		if (buf_ring_) {
+			if (multishot_recv_)
+				io_uring_prep_recv_multishot(sqe, c.fd_, nullptr, 0, 0);
+			else
+				io_uring_prep_recv(sqe, c.fd_, nullptr, buffer_size, 0);
+			sqe->flags |= IOSQE_BUFFER_SELECT;
+			sqe->buf_group = buffer_group;
+		}
+		else {
+			io_uring_prep_recv(sqe, c.fd_, c.read_buffer_.write_data(), c.read_buffer_.write_size(), 0);
+		}
+		io_uring_sqe_set_data64(sqe, make_user_data(c.id_, op_recv));
+		c.recv_armed_ = true;
+	}
+
+	/**
+	 * @brief 将写队列中的消息合并为一次sendmsg
+	 * @param c 连接
+	 * @return
+	 */
+	void submit_send(connection &c) {
+		c.iovecs_.clear();
+		size_t bytes = 0;
+		size_t offset = c.front_offset_;
+		for (const auto &msg : c.write_msgs_) {
+			if (!c.iovecs_.empty() &&
+				(c.iovecs_.size() >= max_send_iovecs || bytes + msg->length() > max_send_bytes))
+				break;
+			iovec v;
+			v.iov_base = const_cast<char *>(msg->data()) + offset;
+			v.iov_len = msg->length() - offset;
+			c.iovecs_.push_back(v);
+			bytes += v.iov_len;
+			offset = 0;
+		}
+		memset(&c.msg_hdr_, 0, sizeof(c.msg_hdr_));
+		c.msg_hdr_.msg_iov = c.iovecs_.data();
+		c.msg_hdr_.msg_iovlen = c.iovecs_.size();
+		auto sqe = get_sqe();
+		c.write_msgs_.set_in_flight(c.iovecs_.size());
+		io_uring_prep_sendmsg(sqe, c.fd_, &c.msg_hdr_, MSG_NOSIGNAL);
+		io_uring_sqe_set_data64(sqe, make_user_data(c.id_, op_send));
+		c.send_in_flight_ = true;
+	}
+
+	void handle_cqe(io_uring_cqe *cqe) {
+		auto data = io_uring_cqe_get_data64(cqe);
+		uint64_t id = data >> 8;
+		switch (static_cast<uring_op>(data & 0xff)) {
+		case op_accept:
+			on_accept(cqe->res, cqe->flags);
+			break;
+		case op_recv:
+			on_recv(id, cqe->res, cqe->flags);
+			break;
+		case op_send:
+			on_send(id, cqe->res);
+			break;
+		case op_wakeup:
+			on_wakeup();
+			break;
+		}
+	}
+
+	void on_accept(int res, unsigned flags) {
+		if (res >= 0) {
+			auto c = std::make_shared<connection>(*this, next_id_++, res, rooms_, names_, queue_options_);
+			connections_[c->id_] = c;
+			c->handler_.start(c);
+			arm_recv(*c);
+		}
+		else if (res == -EINVAL && multishot_accept_) {
+			//内核不支持multishot accept,回退到每次accept后重新提交
+			multishot_accept_ = false;
+		}
+		else if (res == -EINVAL) {
+			std::cerr << "uring server " << server_id_ << " accept: " << strerror(-res) << std::endl;
+			return;
+		}
+		if (!(flags & IORING_CQE_F_MORE) && !stopped_.load(std::memory_order_acquire))
+			arm_accept();
+	}
+
+	void on_recv(uint64_t id, int res, unsigned flags) {
+		auto it = connections_.find(id);
+		if (it == connections_.end()) {
+			if (flags & IORING_CQE_F_BUFFER)
+				recycle_buffer(flags >> IORING_CQE_BUFFER_SHIFT);
+			return;
+		}
+		auto c = it->second;
+		if (!(flags & IORING_CQE_F_MORE))
+			c->recv_armed_ = false;
+
+		if (res == -ENOBUFS || (res == -EINVAL && buf_ring_ && multishot_recv_)) {
+			//缓冲区暂时用完,或内核不支持multishot recv,重新提交即可
+			if (res == -EINVAL)
+				multishot_recv_ = false;
+		}
+		else if (res <= 0) {
+			close_connection(*c);
+		}
+		else {
+			int frames = 0;
+			if (flags & IORING_CQE_F_BUFFER) {
+				unsigned bid = flags >> IORING_CQE_BUFFER_SHIFT;
+				frames = consume(*c, buffers_.data() + size_t(bid) * buffer_size, size_t(res));
+				recycle_buffer(bid);
+			}
+			else {
+				c->read_buffer_.commit(size_t(res));
+				frames = dispatch_frames(*c);
+			}
+			if (frames < 0)
+				close_connection(*c);
+			else
+				server_stats::instance().record_read(frames);
+		}
+
+		if (c->closing_)
+			try_release(*c);
+		else if (!c->recv_armed_)
+			arm_recv(*c);
+	}
+
+	void on_send(uint64_t id, int res) {
+		auto it = connections_.find(id);
+		if (it == connections_.end())
+			return;
+		auto c = it->second;
+		c->send_in_flight_ = false;
+		if (res < 0) {
+			close_connection(*c);
+		}
+		else {
+			size_t sent = size_t(res);
+			size_t msgs = 0;
+			while (sent > 0 && !c->write_msgs_.empty()) {
+				size_t remain = c->write_msgs_.front()->length() - c->front_offset_;
+				if (sent >= remain) {
+					sent -= remain;
+					c->write_msgs_.pop_front(1);
+					c->front_offset_ = 0;
+					++msgs;
+				}
+				else {
+					c->front_offset_ += sent;
+					sent = 0;
+				}
+			}
+			//部分发送的队首消息不能被丢弃
+			c->write_msgs_.set_in_flight(c->front_offset_ ? 1 : 0);
+			server_stats::instance().record_flush(msgs, size_t(res));
+		}
+
+		if (c->closing_)
+			try_release(*c);
+		else if (!c->write_msgs_.empty())
+			submit_send(*c);
+	}
+
+	/**
+	 * @brief 取出收件箱中的所有消息放入各连接的写队列,每个连接只提交一次sendmsg
+	 * @param
+	 * @return
+	 */
+	void on_wakeup() {
+		{
+			std::lock_guard<std::mutex> lock(inbox_mutex_);
+			draining_.swap(inbox_);
+			wakeup_pending_ = false;
+		}
+		std::vector<connection_ptr> ready;
+		for (auto &item : draining_) {
+			auto it = connections_.find(item.first);
+			if (it == connections_.end() || it->second->closing_)
+				continue;
+			auto c = it->second;
+			if (!c->write_msgs_.push(item.second)) {
+				close_connection(*c);
+				try_release(*c);
+				continue;
+			}
+			if (!c->send_in_flight_ && !c->send_pending_ && !c->write_msgs_.empty()) {
+				c->send_pending_ = true;
+				ready.push_back(c);
+			}
+		}
+		draining_.clear();
+		for (auto &c : ready) {
+			c->send_pending_ = false;
+			if (!c->closing_)
+				submit_send(*c);
+		}
+		if (!stopped_.load(std::memory_order_acquire))
+			arm_wakeup();
+	}
+
+	/**
+	 * @brief 将一个provided buffer中的数据拷入连接的接收缓冲区并解析
+	 * @param c 连接
+	 * @param data 数据
+	 * @param length 数据长度
+	 * @return int 解析出的帧数,消息头非法时返回-1
+	 */
+	int consume(connection &c, const char *data, size_t length) {
+		int frames = 0;
+		while (length > 0) {
+			size_t n = std::min(length, c.read_buffer_.write_size());
+			memcpy(c.read_buffer_.write_data(), data, n);
+			c.read_buffer_.commit(n);
+			data += n;
+			length -= n;
+			int parsed = dispatch_frames(c);
+			if (parsed < 0)
+				return -1;
+			frames += parsed;
+		}
+		return frames;
+	}
+
+	int dispatch_frames(connection &c) {
+		return parse_frames(c.read_buffer_,
+			[&c](int type, const char *body, size_t body_length) {
+				c.handler_.handle_message(type, body, body_length);
+			});
+	}
+
+	/**
+	 * @brief 离开房间并关闭读写,等进行中的操作完成后再释放连接
+	 * @param c 连接
+	 * @return
+	 */
+	void close_connection(connection &c) {
+		if (c.closing_)
+			return;
+		c.closing_ = true;
+		c.handler_.stop();
+		shutdown(c.fd_, SHUT_RDWR);
+	}
+
+	void try_release(connection &c) {
+		if (c.recv_armed_ || c.send_in_flight_)
+			return;
+		close(c.fd_);
+		connections_.erase(c.id_);
+	}
+
+private:
+	room_registry &rooms_;
+	session_directory &names_;
+	send_queue_options queue_options_;
+	int server_id_;
+	io_uring ring_;
+	int listen_fd_ = -1;
+	int event_fd_ = -1;
+	uint64_t event_value_ = 0;
+	bool multishot_accept_ = true;
+	bool multishot_recv_ = false;
+	io_uring_buf_ring *buf_ring_ = nullptr;
+	std::vector<char> buffers_;
+	uint64_t next_id_ = 1;
+	std::unordered_map<uint64_t, connection_ptr> connections_;
+	std::mutex inbox_mutex_;
+	std::vector<std::pair<uint64_t, chat_message_ptr>> inbox_;
+	std::vector<std::pair<uint64_t, chat_message_ptr>> draining_;
+	bool wakeup_pending_ = false;
+	std::atomic<bool> stopped_{ false };
+};
+
+uring_server::uring_server(room_registry &rooms, session_directory &names, int port, int server_id,
+						   const server_config &config)
+	: impl_(new impl(rooms, names, port, server_id, config)) {
+}
+
+uring_server::~uring_server() {
+}
+
+/**
+ * @brief 检测当前内核是否支持所需的io_uring操作
+ * @param
+ * @return bool 是否可用
+ */
+bool uring_server::supported() {
+	io_uring ring;
+	if (io_uring_queue_init(8, &ring, 0) < 0)
+		return false;
+	bool ok = false;
+	auto probe = io_uring_get_probe_ring(&ring);
+	if (probe) {
+		ok = io_uring_opcode_supported(probe, IORING_OP_ACCEPT) &&
+			 io_uring_opcode_supported(probe, IORING_OP_RECV) &&
+			 io_uring_opcode_supported(probe, IORING_OP_SENDMSG) &&
+			 io_uring_opcode_supported(probe, IORING_OP_READ);
+		io_uring_free_probe(probe);
+	}
+	io_uring_queue_exit(&ring);
+	return ok;
+}
+
+void uring_server::run() {
+	impl_->run();
+}
+
+void uring_server::stop() {
+	impl_->stop();
+}
+
+#else
+
+class uring_server::impl {
+};
+
+uring_server::uring_server(room_registry &, session_directory &, int, int, const server_config &) {
+	throw std::runtime_error("io_uring support is not compiled in");
+}
+
+uring_server::~uring_server() {
+}
+
+bool uring_server::supported() {
+	return false;
+}
+
+void uring_server::run() {
+}
+
+void uring_server::stop() {
+}
+
+#endif
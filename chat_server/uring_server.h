@@ -0,0 +1,55 @@
+﻿#pragma once
+#include <memory>
+#include <boost/asio.hpp>
+#include "server_config.h"
+#include "room_registry.h"
+#include "session_directory.h"
+
+/**
+ * @brief 基于io_uring的传输后端,负责accept/recv/send,消息处理和房间逻辑与chat_session相同
+ *        仅在Linux上定义CHAT_SERVER_IO_URING并链接liburing(>=2.3)时可用,
+ *        其余情况下supported()返回false,由调用方回退到asio(epoll)
+ */
+class uring_server {
+public:
+	/**
+	 * @brief 构造,创建io_uring和SO_REUSEPORT的监听socket
+	 * @param rooms 所有reactor共享的房间表
+	 * @param names 所有reactor共享的在线名字表
+	 * @param port 监听端口
+	 * @param server_id 本服务的id
+	 * @param config 服务配置,使用其中的发送队列参数
+	 * @return 本类对象
+	 */
+	uring_server(room_registry &rooms, session_directory &names, int port, int server_id = -1,
+				 const server_config &config = server_config());
+	~uring_server();
+
+	uring_server(const uring_server &) = delete;
+	uring_server &operator=(const uring_server &) = delete;
+
+	/**
+	 * @brief 检测当前内核是否支持所需的io_uring操作
+	 * @param
+	 * @return bool 是否可用
+	 */
+	static bool supported();
+
+	/**
+	 * @brief 在当前线程运行事件循环,直到stop被调用
+	 * @param
+	 * @return
+	 */
+	void run();
+
+	/**
+	 * @brief 通知事件循环退出,可在任意线程调用
+	 * @param
+	 * @return
+	 */
+	void stop();
+
+private:
+	class impl;
+	std::unique_ptr<impl> impl_;
+};